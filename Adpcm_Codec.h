@@ -0,0 +1,105 @@
+/**
+ * @file Adpcm_Codec.h
+ * @brief IMA ADPCM 编解码 (固件与服务端共用同一份源码)
+ * @details
+ * 设备端 App_Audio.cpp 和服务端原生扩展 tools/adpcm_native 都直接包含本文件，
+ * 保证上下行两端的查表和舍入规则完全一致。
+ * 打包规则: 每字节 2 个采样，低半字节在前。奇数个采样时最后一个字节的高半字节填 0 (和旧固件一样)，
+ * 解码端会把它当 code 0 解出一个采样，编码端也按 code 0 走一步，两端的预测器状态保持一致。
+ * 本文件不能依赖 Arduino.h (需要在 PC 上编译)。
+ */
+#ifndef ADPCM_CODEC_H
+#define ADPCM_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+static const int8_t adpcm_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const int16_t adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3326, 3658, 4024, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+struct AdpcmState {
+    int32_t valprev;
+    int8_t index;
+};
+
+static inline void adpcm_state_update(AdpcmState *state, uint8_t code, int diffq) {
+    if (code & 8) state->valprev -= diffq;
+    else state->valprev += diffq;
+
+    if (state->valprev > 32767) state->valprev = 32767;
+    else if (state->valprev < -32768) state->valprev = -32768;
+
+    state->index += adpcm_index_table[code];
+    if (state->index < 0) state->index = 0;
+    if (state->index > 88) state->index = 88;
+}
+
+// 解码一个 4-bit code
+static inline int16_t adpcm_decode_sample(uint8_t code, AdpcmState *state) {
+    int step = adpcm_step_table[state->index];
+    int diffq = step >> 3;
+    if (code & 4) diffq += step;
+    if (code & 2) diffq += (step >> 1);
+    if (code & 1) diffq += (step >> 2);
+
+    adpcm_state_update(state, code, diffq);
+    return (int16_t)state->valprev;
+}
+
+// 编码一个采样，返回 4-bit code
+static inline uint8_t adpcm_encode_sample(int16_t sample, AdpcmState *state) {
+    int diff = sample - state->valprev;
+    uint8_t code = 0;
+    if (diff < 0) { code = 8; diff = -diff; }
+
+    int step = adpcm_step_table[state->index];
+    int vpdiff = (step >> 3);
+
+    if (diff >= step) { code |= 4; diff -= step; vpdiff += step; }
+    if (diff >= (step >> 1)) { code |= 2; diff -= (step >> 1); vpdiff += (step >> 1); }
+    if (diff >= (step >> 2)) { code |= 1; vpdiff += (step >> 2); }
+
+    adpcm_state_update(state, code, vpdiff);
+    return code;
+}
+
+// 编码一块 PCM。返回写入 out 的字节数 ((count + 1) / 2)
+static inline size_t adpcm_encode_block(const int16_t *pcm, size_t count, uint8_t *out, AdpcmState *state) {
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        uint8_t lo = adpcm_encode_sample(pcm[i], state);
+        uint8_t hi = adpcm_encode_sample(pcm[i + 1], state);
+        out[n++] = lo | (hi << 4);
+    }
+    if (i < count) {
+        out[n++] = adpcm_encode_sample(pcm[i], state);
+        adpcm_decode_sample(0, state);   // 高半字节填 0，解码端也会按 code 0 走一步
+    }
+    return n;
+}
+
+// 解码一块 ADPCM。pcm 需要容纳 len * 2 个采样，返回采样数
+static inline size_t adpcm_decode_block(const uint8_t *adpcm, size_t len, int16_t *pcm, AdpcmState *state) {
+    for (size_t i = 0; i < len; i++) {
+        pcm[i * 2]     = adpcm_decode_sample(adpcm[i] & 0x0F, state);
+        pcm[i * 2 + 1] = adpcm_decode_sample((adpcm[i] >> 4) & 0x0F, state);
+    }
+    return len * 2;
+}
+
+#endif
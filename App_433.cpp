@@ -1,5 +1,7 @@
 #include "App_433.h"
-#include "App_Display.h" 
+#include "App_Bus.h"
+#include <esp_timer.h>
+#include <Preferences.h>
 
 App433 My433;
 
@@ -13,28 +15,26 @@ App433 My433;
 #define CMT2300A_CUS_INT_EN      0x68
 #define CMT2300A_CUS_INT2_CTL    0x67
 #define CMT2300A_CUS_PKT17       0x48 
+#define CMT2300A_CUS_RSSI_DBM    0x70     // RSSI (dBm + 128)
 
-const uint8_t CMT2300A_S_Data[] = {
-    0x00, 0x00, 0x01, 0x66, 0x02, 0xEC, 0x03, 0x1D, 0x04, 0xF0, 0x05, 0x80, 
-    0x06, 0x14, 0x07, 0x08, 0x08, 0x91, 0x09, 0x02, 0x0A, 0x02, 0x0B, 0xD0,
-    0x0C, 0xAE, 0x0D, 0xE0, 0x0E, 0x35, 0x0F, 0x00, 0x10, 0x00, 0x11, 0xF4, 
-    0x12, 0x10, 0x13, 0xE2, 0x14, 0x42, 0x15, 0x20, 0x16, 0x00, 0x17, 0x81,
-    0x18, 0x42, 0x19, 0xF3, 0x1A, 0xED, 0x1B, 0x1C, 0x1C, 0x42, 0x1D, 0xDD, 
-    0x1E, 0x3B, 0x1F, 0x1C,
-    0x20, 0xD3, 0x21, 0x64, 0x22, 0x10, 0x23, 0x33, 0x24, 0xD1, 0x25, 0x35, 
-    0x26, 0x0D, 0x27, 0x0A, 0x28, 0x9F, 0x29, 0x4B, 0x2A, 0x29, 0x2B, 0x28, 
-    0x2C, 0xC0, 0x2D, 0x28, 0x2E, 0x0A, 0x2F, 0x53, 0x30, 0x08, 0x31, 0x00, 
-    0x32, 0xB4, 0x33, 0x00, 0x34, 0x00, 0x35, 0x01, 0x36, 0x00, 0x37, 0x00, 
-    0x38, 0x12, 0x39, 0x08, 0x3A, 0x00, 0x3B, 0xAA, 0x3C, 0x16, 0x3D, 0x00, 
-    0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x3C, 0x42, 0x7E, 0x43, 0x3C, 
-    0x44, 0x7E, 0x45, 0x05, 0x46, 0x1F, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 
-    0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x03, 0x4D, 0xFF, 0x4E, 0xFF, 0x4F, 0x60, 
-    0x50, 0xFF, 0x51, 0x00, 0x52, 0x09, 0x53, 0x40, 0x54, 0x90,
-    0x55, 0x70, 0x56, 0xFE, 0x57, 0x06, 0x58, 0x00, 0x59, 0x0F, 0x5A, 0x70, 
-    0x5B, 0x00, 0x5C, 0x8A, 0x5D, 0x18, 0x5E, 0x3F, 0x5F, 0x6A
-};
+#define CMT2300A_GO_STBY         0x02
+#define CMT2300A_GO_RX           0x08
+#define CMT2300A_GO_TX           0x40
+#define CMT2300A_FIFO_WRITE_TX   0x05     // FIFO_CTL: SPI 写 FIFO + FIFO 给 TX 用
+#define CMT2300A_CLR_TX_FIFO     0x01
+#define CMT2300A_TX_DONE_FLG     0x08     // INT_CLR1 读
+#define CMT2300A_TX_DONE_CLR     0x04     // INT_CLR1 写
 
 // ================= 底层实现 =================
+#if CMT_USE_BITBANG
+
+bool App433::busInit() {
+    pinMode(PIN_RF_CSB, OUTPUT); pinMode(PIN_RF_FCSB, OUTPUT);
+    pinMode(PIN_RF_SCLK, OUTPUT); pinMode(PIN_RF_SDIO, OUTPUT);
+    digitalWrite(PIN_RF_CSB, HIGH); digitalWrite(PIN_RF_FCSB, HIGH); digitalWrite(PIN_RF_SCLK, LOW);
+    return true;
+}
+
 void App433::delay_us(uint32_t n) { delayMicroseconds(n); }
 
 void App433::cmt_spi_send(uint8_t data) {
@@ -87,6 +87,10 @@ uint8_t App433::readReg(uint8_t addr) {
     return val;
 }
 
+void App433::writeRegs(const uint8_t* pairs, size_t count) {
+    for (size_t i = 0; i < count; i++) writeReg(pairs[i * 2], pairs[i * 2 + 1]);
+}
+
 void App433::readFifo(uint8_t* buf, uint16_t len) {
     for (uint16_t i = 0; i < len; i++) {
         digitalWrite(PIN_RF_FCSB, LOW);
@@ -94,82 +98,517 @@ void App433::readFifo(uint8_t* buf, uint16_t len) {
         buf[i] = cmt_spi_recv();
         delay_us(2);
         digitalWrite(PIN_RF_FCSB, HIGH);
-        delay_us(4);
+        delay_us(CMT_FCSB_GAP_US);
+    }
+}
+
+void App433::writeFifo(const uint8_t* buf, uint16_t len) {
+    for (uint16_t i = 0; i < len; i++) {
+        digitalWrite(PIN_RF_FCSB, LOW);
+        delay_us(2);
+        cmt_spi_send(buf[i]);
+        delay_us(2);
+        digitalWrite(PIN_RF_FCSB, HIGH);
+        delay_us(CMT_FCSB_GAP_US);
+    }
+}
+
+#else  // 硬件 SPI
+
+bool App433::busInit() {
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = PIN_RF_SDIO;      // 3 线模式下 MOSI 兼做输入
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = PIN_RF_SCLK;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = 4;
+    bus.flags = SPICOMMON_BUSFLAG_MASTER;
+    if (spi_bus_initialize(CMT_SPI_HOST, &bus, SPI_DMA_DISABLED) != ESP_OK) return false;
+
+    // 寄存器: 8 位地址 (bit7 = 读) + 8 位数据
+    spi_device_interface_config_t reg = {};
+    reg.address_bits = 8;
+    reg.mode = 0;
+    reg.clock_speed_hz = CMT_SPI_HZ;
+    reg.spics_io_num = PIN_RF_CSB;
+    reg.cs_ena_pretrans = 2;            // 片选建立/保持各 1us (与原来的时序相当)
+    reg.cs_ena_posttrans = 2;
+    reg.flags = SPI_DEVICE_3WIRE | SPI_DEVICE_HALFDUPLEX;
+    reg.queue_size = 1;
+
+    // FIFO: 每次一个字节，没有地址
+    spi_device_interface_config_t fifo = reg;
+    fifo.address_bits = 0;
+    fifo.spics_io_num = PIN_RF_FCSB;
+
+    return spi_bus_add_device(CMT_SPI_HOST, &reg, &_regDev) == ESP_OK &&
+           spi_bus_add_device(CMT_SPI_HOST, &fifo, &_fifoDev) == ESP_OK;
+}
+
+void App433::writeReg(uint8_t addr, uint8_t data) {
+    spi_transaction_t t = {};
+    t.flags = SPI_TRANS_USE_TXDATA;
+    t.addr = addr & 0x7F;
+    t.length = 8;
+    t.tx_data[0] = data;
+    spi_device_polling_transmit(_regDev, &t);
+}
+
+uint8_t App433::readReg(uint8_t addr) {
+    spi_transaction_t t = {};
+    t.flags = SPI_TRANS_USE_RXDATA;
+    t.addr = addr | 0x80;
+    t.length = 8;
+    t.rxlength = 8;
+    spi_device_polling_transmit(_regDev, &t);
+    return t.rx_data[0];
+}
+
+// CMT2300A 的寄存器不支持地址自增，每个寄存器仍是一次事务；
+// 但总线只锁一次，每次事务只剩十几 us 的硬件时序
+void App433::writeRegs(const uint8_t* pairs, size_t count) {
+    spi_device_acquire_bus(_regDev, portMAX_DELAY);
+    for (size_t i = 0; i < count; i++) writeReg(pairs[i * 2], pairs[i * 2 + 1]);
+    spi_device_release_bus(_regDev);
+}
+
+void App433::readFifo(uint8_t* buf, uint16_t len) {
+    spi_device_acquire_bus(_fifoDev, portMAX_DELAY);
+    for (uint16_t i = 0; i < len; i++) {
+        spi_transaction_t t = {};
+        t.flags = SPI_TRANS_USE_RXDATA;
+        t.length = 8;
+        t.rxlength = 8;
+        spi_device_polling_transmit(_fifoDev, &t);
+        buf[i] = t.rx_data[0];
+        if (i + 1 < len) delayMicroseconds(CMT_FCSB_GAP_US);
+    }
+    spi_device_release_bus(_fifoDev);
+}
+
+void App433::writeFifo(const uint8_t* buf, uint16_t len) {
+    spi_device_acquire_bus(_fifoDev, portMAX_DELAY);
+    for (uint16_t i = 0; i < len; i++) {
+        spi_transaction_t t = {};
+        t.flags = SPI_TRANS_USE_TXDATA;
+        t.length = 8;
+        t.tx_data[0] = buf[i];
+        spi_device_polling_transmit(_fifoDev, &t);
+        if (i + 1 < len) delayMicroseconds(CMT_FCSB_GAP_US);
     }
+    spi_device_release_bus(_fifoDev);
+}
+
+#endif
+
+void App433::getStats(Cmt433Stats* out) {
+    if (out) *out = _stats;
 }
 
 // ================= 高层逻辑 =================
 
-void App433::RX_Init() {
-    pinMode(PIN_RF_CSB, OUTPUT); pinMode(PIN_RF_FCSB, OUTPUT);
-    pinMode(PIN_RF_SCLK, OUTPUT); pinMode(PIN_RF_SDIO, OUTPUT);
+bool App433::RX_Init() {
     pinMode(PIN_RF_GPIO3, INPUT);
+    if (!busInit()) {
+        Serial.println("[433] SPI init failed!");
+        return false;
+    }
 
-    digitalWrite(PIN_RF_CSB, HIGH); digitalWrite(PIN_RF_FCSB, HIGH); digitalWrite(PIN_RF_SCLK, LOW);
-    
     writeReg(0x7F, 0xFF); // Soft Reset
     delay(20);
-    
-    for(int i=0; i<sizeof(CMT2300A_S_Data); i+=2) {
-        writeReg(CMT2300A_S_Data[i], CMT2300A_S_Data[i+1]);
-    }
+
+    int64_t t0 = esp_timer_get_time();
+    _stats.initRegs = sizeof(CMT2300A_S_Data) / 2;
+    writeRegs(CMT2300A_S_Data, _stats.initRegs);
+    _stats.initUs = (uint32_t)(esp_timer_get_time() - t0);
     
     writeReg(CMT2300A_CUS_IO_SEL, 0x20);   // GPIO3 = INT2
     writeReg(CMT2300A_CUS_INT2_CTL, 0x07); // INT2 = PKT_OK
     writeReg(CMT2300A_CUS_INT_EN, 0x01);   // Enable PKT_DONE
     
-    Serial.println("[433] Init Done.");
+    Serial.printf("[433] Init Done (%s): %u regs in %u us\n", CMT_USE_BITBANG ? "bitbang" : "SPI3",
+                  _stats.initRegs, (unsigned)_stats.initUs);
+    return true;
 }
 
 void App433::RX_GoReceive() {
-    writeReg(CMT2300A_CUS_MODE_CTL, 0x02); // STBY
+    writeReg(CMT2300A_CUS_MODE_CTL, CMT2300A_GO_STBY);
     writeReg(CMT2300A_CUS_FIFO_CLR, 0x02); // Clear RX FIFO
     writeReg(CMT2300A_CUS_INT_CLR1, 0xFF);
     writeReg(CMT2300A_CUS_INT_CLR2, 0xFF);
     writeReg(CMT2300A_CUS_FIFO_CTL, 0x00); // FIFO Read Mode
-    writeReg(CMT2300A_CUS_MODE_CTL, 0x08); // Go RX
+    writeReg(CMT2300A_CUS_MODE_CTL, CMT2300A_GO_RX);
 }
 
-void App433::init() {
-    RX_Init();
+bool App433::init() {
+    _task = xTaskGetCurrentTaskHandle();
+    if (!RX_Init()) return false;
+    _profileSinceMs = millis();
+
+    // 上次选的配置档
+    Preferences prefs;
+    char name[16] = {0};
+    if (prefs.begin(RF_NVS_NAMESPACE, true)) {
+        prefs.getString(RF_NVS_PROFILE_KEY, name, sizeof(name));
+        prefs.end();
+    }
+    for (uint8_t i = 1; i < CMT_PROFILE_COUNT; i++) {
+        if (strcmp(name, kCmtProfiles[i].name) == 0) applyProfile(i);
+    }
+
+    _link.setHandler(onLinkRequest, this);
+    addDecoder(decodeLink, NULL);      // 链路帧有魔数和 CRC，先认领
+    addDecoder(decodeToggle, NULL);
     RX_GoReceive();
+    attachInterrupt(digitalPinToInterrupt(PIN_RF_GPIO3), onPacketIsr, RISING);
+    _ready = true;
+    return true;
+}
+
+bool App433::addDecoder(Rf433Decoder fn, void* ctx) {
+    if (_decoderCount >= RF_MAX_DECODERS) return false;
+    _decoders[_decoderCount].fn = fn;
+    _decoders[_decoderCount].ctx = ctx;
+    _decoderCount++;
+    return true;
+}
+
+void IRAM_ATTR App433::onPacketIsr() {
+    BaseType_t woken = pdFALSE;
+    My433._stats.irqs++;
+    if (My433._task) vTaskNotifyGiveFromISR(My433._task, &woken);
+    if (woken) portYIELD_FROM_ISR();
 }
 
 void App433::loop() {
-    if (digitalRead(PIN_RF_GPIO3) == HIGH) {
-        
-        writeReg(CMT2300A_CUS_MODE_CTL, 0x02); // 1. 先 STBY
-        
-        uint8_t buffer[32];
-        memset(buffer, 0, 32);
-        readFifo(buffer, 20); // 2. 读取数据
-        
-        // 转换为 String
-        String rxData = "";
-        for(int i=0; i<20; i++) {
-            if(buffer[i] >= 32 && buffer[i] <= 126) rxData += (char)buffer[i];
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RF_WAIT_MS));
+
+    int8_t next = _pendingProfile;
+    if (next >= 0) {
+        _pendingProfile = -1;
+        applyProfile((uint8_t)next);
+        Preferences prefs;
+        if (prefs.begin(RF_NVS_NAMESPACE, false)) {
+            prefs.putString(RF_NVS_PROFILE_KEY, kCmtProfiles[next].name);
+            prefs.end();
+        }
+    }
+    drain();
+
+    Rf433Packet pkt;
+    while (_packets.pop(pkt)) dispatch(pkt);
+    runPending();
+}
+
+// PKT_OK 一直是高电平就说明还有包没读 (中断只在上升沿触发)
+void App433::drain() {
+    // 最多读一队列的包，芯片异常 (电平卡在高) 时不至于死循环
+    for (int n = 0; n < RF_PACKET_SLOTS; n++) {
+        Rf433Packet pkt;
+        if (!readPacket(pkt)) break;
+        if (!_packets.push(pkt)) _stats.dropped++;
+    }
+}
+
+// 有包就读出来并重新进 RX，没有返回 false
+bool App433::readPacket(Rf433Packet& pkt) {
+    if (digitalRead(PIN_RF_GPIO3) != HIGH) return false;
+    pkt.rssiDbm = (int8_t)(readReg(CMT2300A_CUS_RSSI_DBM) - 128);  // 切 STBY 前读，RX 状态下才有效
+    pkt.timeMs = millis();
+    pkt.len = CMT_PACKET_LEN;
+
+    writeReg(CMT2300A_CUS_MODE_CTL, CMT2300A_GO_STBY); // 先 STBY 再读 FIFO
+
+    int64_t t0 = esp_timer_get_time();
+    readFifo(pkt.data, CMT_PACKET_LEN);
+    _stats.lastFifoUs = (uint32_t)(esp_timer_get_time() - t0);
+    if (_stats.lastFifoUs > _stats.maxFifoUs) _stats.maxFifoUs = _stats.lastFifoUs;
+    _stats.packets++;
+    _profileStats[_profile].rxPackets++;
+    _profileStats[_profile].rssiSum += pkt.rssiDbm;
+
+    RX_GoReceive();   // 清中断，GPIO3 回到低电平
+    return true;
+}
+
+// ================= 发送 (RfRadio) =================
+bool App433::send(const uint8_t* frame, size_t len) {
+    if (len > CMT_PACKET_LEN) return false;
+    uint8_t buf[CMT_PACKET_LEN] = {0};   // 定长包，不足补 0
+    memcpy(buf, frame, len);
+
+    int64_t t0 = esp_timer_get_time();
+    writeReg(CMT2300A_CUS_MODE_CTL, CMT2300A_GO_STBY);
+    writeReg(CMT2300A_CUS_FIFO_CTL, CMT2300A_FIFO_WRITE_TX);
+    writeReg(CMT2300A_CUS_FIFO_CLR, CMT2300A_CLR_TX_FIFO);
+    writeReg(CMT2300A_CUS_INT_CLR1, CMT2300A_TX_DONE_CLR);
+    writeFifo(buf, CMT_PACKET_LEN);
+    writeReg(CMT2300A_CUS_MODE_CTL, CMT2300A_GO_TX);
+    int64_t txStart = esp_timer_get_time();
+
+    // 发一帧十几到几十 ms，轮询间隔 1 tick；超时给两倍空中时间
+    uint32_t limitUs = _link.airtimeUs() * 2 + 5000;
+    bool done;
+    for (;;) {
+        done = (readReg(CMT2300A_CUS_INT_CLR1) & CMT2300A_TX_DONE_FLG) != 0;
+        if (done || esp_timer_get_time() - t0 > limitUs) break;
+        vTaskDelay(1);
+    }
+    int64_t end = esp_timer_get_time();
+    _stats.lastTxUs = (uint32_t)(end - t0);
+    if (done) {
+        _stats.txFrames++;
+        _profileStats[_profile].txFrames++;
+    } else {
+        _stats.txTimeouts++;
+    }
+
+    RX_GoReceive();   // 也清掉 TX_DONE，FIFO 切回读
+    checkBitrate((uint32_t)(end - txStart), done);
+    return done;
+}
+
+// 实测空中时间含 1 tick 以内的轮询误差 (20 字节帧约 22ms 时不到 5%)，反推的数据率偏低一点，
+// 对 ACK 超时来说是保守的一侧
+void App433::checkBitrate(uint32_t airUs, bool done) {
+    if (airUs == 0) return;
+    uint32_t bits = (RF_PREAMBLE_BYTES + RF_SYNC_BYTES + CMT_PACKET_LEN) * 8;
+    uint32_t bps = (uint32_t)((uint64_t)bits * 1000000 / airUs);
+    uint32_t cur = _link.bitrate();
+    if (done) _stats.measuredBps = bps;
+    else if (bps >= cur) return;   // 超时上限本来就比空中时间长，没有新信息
+
+    uint32_t diff = bps > cur ? bps - cur : cur - bps;
+    if (diff * 100 <= cur * RF_RATE_TOLERANCE_PCT) return;
+    _link.setBitrate(bps);
+    Serial.printf("[433] 数据率与配置不符: 表里 %u bps，%s %u bps，按实测值算 ACK 超时\n",
+                  (unsigned)kCmtProfiles[_profile].bitrate, done ? "实测" : "TX 超时，至多", (unsigned)bps);
+}
+
+bool App433::receive(uint8_t* frame, uint32_t timeoutUs) {
+    Rf433Packet pkt;
+    uint32_t start = nowUs();
+    while (!readPacket(pkt)) {
+        uint32_t spent = nowUs() - start;
+        if (spent >= timeoutUs) return false;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS((timeoutUs - spent + 999) / 1000));
+    }
+    memcpy(frame, pkt.data, RF_FRAME_LEN);
+    _lastRssi = pkt.rssiDbm;
+    return true;
+}
+
+// 等 ACK 时收到的其它包放回包队列，事务结束后照常分发
+void App433::defer(const uint8_t* frame) {
+    Rf433Packet pkt;
+    pkt.len = CMT_PACKET_LEN;
+    pkt.rssiDbm = _lastRssi;
+    pkt.timeMs = millis();
+    memcpy(pkt.data, frame, CMT_PACKET_LEN);
+    if (!_packets.push(pkt)) _stats.dropped++;
+}
+
+uint32_t App433::nowUs() {
+    return (uint32_t)esp_timer_get_time();
+}
+
+bool App433::post(uint8_t dst, RfType type, const uint8_t* payload, size_t n) {
+    if (!_ready) return false;
+    TxRequest req;
+    req.dst = dst;
+    req.type = type;
+    req.len = (uint8_t)(n > RF_MAX_PAYLOAD ? RF_MAX_PAYLOAD : n);
+    memcpy(req.payload, payload, req.len);
+    if (!_txQueue.push(req)) return false;
+    if (_task) xTaskNotifyGive(_task);
+    return true;
+}
+
+void App433::runPending() {
+    TxRequest req;
+    while (_txQueue.pop(req)) {
+        RfFrame reply;
+        uint32_t retries = _link.stats().retries;
+        bool ok = _link.transact(req.dst, (RfType)req.type, req.payload, req.len, &reply);
+        const RfLinkStats& ls = _link.stats();
+        Rf433ProfileStats& ps = _profileStats[_profile];
+        ps.retries += ls.retries - retries;
+        if (ok) ps.acked++;
+        else ps.failed++;
+        if (ok) {
+            Serial.printf("[433] -> %02X ACK, RTT %u us, %u bytes back (%d dBm)\n", req.dst, (unsigned)ls.lastRttUs,
+                          reply.len, _lastRssi);
+        } else {
+            Serial.printf("[433] -> %02X 无应答 (重发 %d 次)\n", req.dst, RF_RETRIES);
+        }
+        Rf433Packet pkt;
+        while (_packets.pop(pkt)) dispatch(pkt);
+    }
+}
+
+// ================= 配置档 =================
+bool App433::setProfile(const char* name) {
+    if (!_ready) return false;
+    for (uint8_t i = 0; i < CMT_PROFILE_COUNT; i++) {
+        if (strcmp(name, kCmtProfiles[i].name) == 0) {
+            _pendingProfile = (int8_t)i;
+            if (_task) xTaskNotifyGive(_task);
+            return true;
+        }
+    }
+    return false;
+}
+
+// 只在 Task433 里调用: STBY 下写两档之间不同的寄存器，再回到 RX
+void App433::applyProfile(uint8_t idx) {
+    if (idx >= CMT_PROFILE_COUNT || idx == _profile) return;
+    uint8_t pairs[CMT_PROFILE_MAX_WRITES * 2];
+    size_t n = cmtProfileSwitch(kCmtProfiles[_profile], kCmtProfiles[idx], pairs, CMT_PROFILE_MAX_WRITES);
+
+    uint32_t now = millis();
+    _profileStats[_profile].activeMs += now - _profileSinceMs;
+    _profileSinceMs = now;
+
+    int64_t t0 = esp_timer_get_time();
+    writeReg(CMT2300A_CUS_MODE_CTL, CMT2300A_GO_STBY);
+    writeRegs(pairs, n);
+    RX_GoReceive();
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+
+    _profile = idx;
+    _link.setBitrate(kCmtProfiles[idx].bitrate);
+    Serial.printf("[433] 配置档 %s (%u bps): 写 %u 个寄存器, %u us\n", kCmtProfiles[idx].name,
+                  (unsigned)kCmtProfiles[idx].bitrate, (unsigned)n, (unsigned)us);
+}
+
+void App433::getProfileStats(uint8_t idx, Rf433ProfileStats* out) {
+    if (!out || idx >= CMT_PROFILE_COUNT) return;
+    *out = _profileStats[idx];
+    if (idx == _profile) out->activeMs += millis() - _profileSinceMs;
+}
+
+void App433::printProfiles() {
+    for (uint8_t i = 0; i < CMT_PROFILE_COUNT; i++) {
+        Rf433ProfileStats ps;
+        getProfileStats(i, &ps);
+        uint32_t perMin = ps.activeMs ? (uint32_t)((uint64_t)ps.rxPackets * 60000 / ps.activeMs) : 0;
+        uint32_t expected = ps.rxPackets + ps.missed;
+        uint32_t sent = ps.acked + ps.failed;
+        // 漏收按序号跳号估计，对端也在和别的节点通信时偏大
+        Serial.printf("%c %-10s %6u bps %4u regs | %5u s, RX %u (%u/min), 漏收 %u.%u%%, ACK 失败 %u/%u, 重发 %u, %d dBm\n",
+                      i == _profile ? '*' : ' ', kCmtProfiles[i].name, (unsigned)kCmtProfiles[i].bitrate,
+                      kCmtProfiles[i].diffCount, (unsigned)(ps.activeMs / 1000), (unsigned)ps.rxPackets,
+                      (unsigned)perMin,
+                      (unsigned)(expected ? ps.missed * 100 / expected : 0),
+                      (unsigned)(expected ? ps.missed * 1000 / expected % 10 : 0), (unsigned)ps.failed,
+                      (unsigned)sent, (unsigned)ps.retries, ps.rxPackets ? (int)(ps.rssiSum / (int32_t)ps.rxPackets) : 0);
+    }
+}
+
+bool App433::handleSerial(const String& cmd) {
+    if (cmd == "RF_PROFILE") {
+        printProfiles();
+        return true;
+    }
+    if (cmd.startsWith("RF_PROFILE=")) {
+        if (!_ready) Serial.println("[433] 射频没有初始化");
+        else if (CMT_PROFILE_COUNT < 2) Serial.println("[433] 只有基础档，其它档要从 RFPDK 导出后加进 kCmtProfiles");
+        else if (!setProfile(cmd.c_str() + 11)) Serial.printf("[433] 没有配置档 \"%s\"\n", cmd.c_str() + 11);
+        return true;
+    }
+    if (cmd == "RF") {
+        const RfLinkStats& ls = _link.stats();
+        Serial.printf("[433] TX %u (timeout %u, last %u us), RX %u, unknown %u, dropped %u\n", (unsigned)_stats.txFrames,
+                      (unsigned)_stats.txTimeouts, (unsigned)_stats.lastTxUs, (unsigned)_stats.packets,
+                      (unsigned)_stats.unknown, (unsigned)_stats.dropped);
+        Serial.printf("[433] bitrate: table %u, measured %u, link %u bps\n", (unsigned)kCmtProfiles[_profile].bitrate,
+                      (unsigned)_stats.measuredBps, (unsigned)_link.bitrate());
+        Serial.printf("[433] link: %u req, %u acked, %u failed, %u retries, %u dup; RTT min %u avg %u max %u us, "
+                      "airtime %u us\n",
+                      (unsigned)ls.transactions, (unsigned)ls.acked, (unsigned)ls.failed, (unsigned)ls.retries,
+                      (unsigned)ls.duplicates, (unsigned)ls.minRttUs,
+                      (unsigned)(ls.acked ? ls.sumRttUs / ls.acked : 0), (unsigned)ls.maxRttUs,
+                      (unsigned)_link.airtimeUs());
+        return true;
+    }
+    bool poll = cmd.startsWith("RF_POLL=");
+    if (!poll && !cmd.startsWith("RF=")) return false;
+
+    // RF=地址,十六进制负载  (地址也是十六进制)
+    const char* p = cmd.c_str() + (poll ? 8 : 3);
+    char* end;
+    unsigned long dst = strtoul(p, &end, 16);
+    uint8_t payload[RF_MAX_PAYLOAD];
+    size_t n = 0;
+    if (!poll && *end == ',') {
+        for (const char* h = end + 1; h[0] && h[1] && n < RF_MAX_PAYLOAD; h += 2) {
+            char byte[3] = { h[0], h[1], 0 };
+            payload[n++] = (uint8_t)strtoul(byte, NULL, 16);
         }
-        
-        Serial.println("[433] RX: " + rxData);
-
-        // ================= 防抖逻辑 Start =================
-        static uint32_t lastActionTime = 0;
-        uint32_t now = millis();
-        const uint32_t COOLDOWN = 1000; // 冷却时间 1000ms (1秒)
-
-        if (rxData.indexOf("TOGGLE") >= 0) {
-            // 只有当距离上次操作超过 1秒 时才执行
-            if (now - lastActionTime > COOLDOWN) {
-                MyDisplay.toggleBacklight();
-                lastActionTime = now;
-                Serial.println(">>> Action: TOGGLE Executed");
-            } else {
-                Serial.println(">>> Ignored: Cooling down...");
-            }
+    }
+    if (end == p || dst == 0 || dst >= RF_BROADCAST) {
+        Serial.println("[433] 用法: RF=地址,负载 / RF_POLL=地址 (十六进制)");
+    } else if (!_ready) {
+        Serial.println("[433] 射频没有初始化");
+    } else if (!post((uint8_t)dst, poll ? RF_T_POLL : RF_T_CMD, payload, n)) {
+        Serial.println("[433] 发送队列满");
+    }
+    return true;
+}
+
+void App433::dispatch(const Rf433Packet& pkt) {
+    for (uint8_t i = 0; i < _decoderCount; i++) {
+        if (_decoders[i].fn(pkt, _decoders[i].ctx)) {
+            _stats.handled++;
+            return;
         }
-        // ================= 防抖逻辑 End =================
+    }
+    _stats.unknown++;
+
+    // 没人认领: 每秒最多打印一包，可打印字符原样，其余用 '.'
+    uint32_t now = millis();
+    if (now - _lastLogMs < RF_LOG_INTERVAL_MS) {
+        _logSkipped++;
+        return;
+    }
+    char text[CMT_PACKET_LEN + 1];
+    for (uint8_t i = 0; i < pkt.len; i++) text[i] = (pkt.data[i] >= 32 && pkt.data[i] <= 126) ? (char)pkt.data[i] : '.';
+    text[pkt.len] = '\0';
+    Serial.printf("[433] RX %s (%d dBm, FIFO %u us, %u not shown)\n", text, pkt.rssiDbm,
+                  (unsigned)_stats.lastFifoUs, (unsigned)_logSkipped);
+    _lastLogMs = now;
+    _logSkipped = 0;
+}
+
+// ================= 解码器 =================
+// 链路帧: 请求自动回 ACK，上报交给 onLinkRequest
+bool App433::decodeLink(const Rf433Packet& pkt, void* ctx) {
+    My433._lastRssi = pkt.rssiDbm;
+    uint32_t missed = My433._link.stats().missed;
+    bool mine = My433._link.onReceive(pkt.data);
+    My433._profileStats[My433._profile].missed += My433._link.stats().missed - missed;
+    return mine;
+}
 
-        // 3. 继续接收
-        RX_GoReceive();
+// 设备发给面板的帧 (传感器上报等)，目前只打印；回的 ACK 不带负载
+size_t App433::onLinkRequest(const RfFrame& req, uint8_t* reply, void* ctx) {
+    Serial.printf("[433] <- %02X type %u seq %u:", req.src, req.type, req.seq);
+    for (uint8_t i = 0; i < req.len; i++) Serial.printf(" %02X", req.payload[i]);
+    Serial.printf(" (%d dBm)\n", My433._lastRssi);
+    return 0;
+}
+
+// 遥控器发的文本命令 "TOGGLE": 切换屏幕，1 秒内重复的忽略
+bool App433::decodeToggle(const Rf433Packet& pkt, void* ctx) {
+    static const char kToggle[] = "TOGGLE";
+    static uint32_t lastActionMs = 0;
+    if (memmem(pkt.data, pkt.len, kToggle, sizeof(kToggle) - 1) == NULL) return false;
+
+    if (pkt.timeMs - lastActionMs > RF_TOGGLE_COOLDOWN_MS) {
+        MyBus.publish(BUS_REMOTE, REMOTE_TOGGLE, pkt.rssiDbm);
+        lastActionMs = pkt.timeMs;
+        Serial.printf("[433] TOGGLE (%d dBm)\n", pkt.rssiDbm);
     }
-}
\ No newline at end of file
+    return true;
+}
@@ -1,27 +1,198 @@
+/**
+ * @file App_433.h
+ * @brief 433MHz 射频 (CMT2300A) 驱动与接收逻辑
+ * @details
+ * CMT2300A 是 3 线 SPI: SDIO 双向，CSB 选寄存器，FCSB 选 FIFO。
+ * 默认走 S3 的 SPI3 外设 (SPI2 给了屏幕)，3 线半双工，寄存器和 FIFO 各挂一个设备，
+ * 片选由硬件控制；批量写寄存器、读 FIFO 期间一直占着总线，中间不再抢锁。
+ * 芯片要求 FIFO 每个字节单独拉一次 FCSB，所以 FIFO 的 "批量" 是连续的单字节事务。
+ * CMT_USE_BITBANG = 1 时退回原来的 GPIO 模拟时序，便于对比。
+ * 初始化和每包读取耗时用 esp_timer 计量，getStats 可查。两种方式还没有在硬件上实测，
+ * 下面是按时序估算的: 每个寄存器约 70us (GPIO) / 12us (SPI3)，整表约 96 个；
+ * 每包 20 字节 FIFO 约 1ms / 0.2ms。实测后以启动日志和 RF 命令的输出为准。
+ * SPI 初始化失败时 init 返回 false，不写芯片、不装中断，收发和切档请求都会被拒绝。
+ *
+ * 接收: GPIO3 (INT2 = PKT_OK) 上升沿中断只通知 Task433；任务读 FIFO 和 RSSI，
+ * 把定长的 Rf433Packet 放进无锁队列，再交给按顺序登记的解码器，
+ * 第一个认领的解码器处理它。没人认领的包限频打印，不会刷屏。
+ *
+ * 发送: App433 同时是 Rf_Link.h 的 RfRadio。post() 把请求放进发送队列并唤醒 Task433，
+ * 由任务执行 RfLink::transact (发帧 -> 等 ACK -> 超时重发)，收发都在同一个任务里，
+ * 不需要给 SPI 加锁。等 ACK 期间收到的其它包照常进包队列，事务结束后再分发。
+ *
+ * 数据率: CMT_BASE_BITRATE_BPS 还没有和 RFPDK 工程核对过，ACK 超时又是按它算的。
+ * 每次发送用 GO_TX 到 TX_DONE 的时间反推实际数据率，与链路层所用值差 RF_RATE_TOLERANCE_PCT
+ * 以上时改用实测值并打印；等不到 TX_DONE 时按超时上限放慢，下一帧等得更久。
+ *
+ * 配置档 (Cmt_Profiles.h): setProfile 只记下目标档并唤醒 Task433，由任务在 STBY 下
+ * 只写两档之间不同的寄存器，选择存进 NVS，重启后沿用。每档单独统计收包率、
+ * 跳号 (漏收)、ACK 失败和 RSSI。目前只带基础档，远距离/高速档要从 RFPDK 导出后再加，
+ * 在那之前 RF_PROFILE= 只会提示没有别的档。
+ */
 #ifndef APP_433_H
 #define APP_433_H
 
 #include <Arduino.h>
-#include "Pin_Config.h" 
+#include <driver/spi_master.h>
+#include "Pin_Config.h"
+#include "Lockfree_Ring.h"
+#include "Rf_Link.h"
+#include "Cmt_Profiles.h"
 
-class App433 {
+#ifndef CMT_USE_BITBANG
+#define CMT_USE_BITBANG   0
+#endif
+
+#define CMT_SPI_HOST        SPI3_HOST
+#define CMT_SPI_HZ          2000000     // 数据手册上限 10MHz，留余量
+#define CMT_FCSB_GAP_US     4           // FIFO 相邻字节之间 FCSB 保持高电平的时间
+#define CMT_PACKET_LEN      20
+#define RF_PACKET_SLOTS     8
+#define RF_MAX_DECODERS     4
+#define RF_WAIT_MS          1000        // 兜底: 错过边沿时按电平再查一次
+#define RF_LOG_INTERVAL_MS  1000        // 未识别包的打印间隔
+#define RF_TOGGLE_COOLDOWN_MS 1000
+#define RF_SELF_ID          0x01        // 面板的链路地址
+#define RF_PREAMBLE_BYTES   4
+#define RF_SYNC_BYTES       2
+#define RF_RETRIES          3
+#define RF_TURNAROUND_US    3000        // 对端读 FIFO + 切 TX
+#define RF_TX_SLOTS         4
+#define RF_NVS_NAMESPACE    "rf"
+#define RF_NVS_PROFILE_KEY  "profile"
+#define RF_RATE_TOLERANCE_PCT 25        // 实测数据率与链路层所用值差这么多就改用实测值
+
+static_assert(CMT_PACKET_LEN == RF_FRAME_LEN, "链路帧必须和芯片的定长包一样长");
+
+// 一包数据，定长、可平凡拷贝
+struct Rf433Packet {
+    uint8_t len;
+    int8_t rssiDbm;
+    uint32_t timeMs;
+    uint8_t data[CMT_PACKET_LEN];
+};
+
+// 解码器: 认领 (处理) 了这个包返回 true，后面的解码器不再看
+typedef bool (*Rf433Decoder)(const Rf433Packet& pkt, void* ctx);
+
+struct Cmt433Stats {
+    uint32_t initUs;         // 软复位后写完整张寄存器表的耗时 (不含复位等待)
+    uint16_t initRegs;       // 写入的寄存器数
+    uint32_t lastFifoUs;     // 最近一包的 FIFO 读取耗时
+    uint32_t maxFifoUs;
+    uint32_t packets;
+    uint32_t irqs;           // 中断次数
+    uint32_t dropped;        // 包队列满
+    uint32_t handled;        // 被解码器认领
+    uint32_t unknown;        // 没有解码器认领
+    uint32_t txFrames;
+    uint32_t txTimeouts;     // 等不到 TX_DONE
+    uint32_t lastTxUs;       // 写 FIFO 到 TX_DONE
+    uint32_t measuredBps;    // GO_TX 到 TX_DONE 反推的数据率 (0 = 还没发成功过)
+};
+
+// 某一配置档生效期间的累计
+struct Rf433ProfileStats {
+    uint32_t activeMs;       // 累计生效时间
+    uint32_t rxPackets;
+    uint32_t missed;         // 链路帧序号跳号 (见 RfLinkStats::missed，对端和别的节点通信时偏大)
+    uint32_t txFrames;
+    uint32_t acked;
+    uint32_t failed;         // 重发用完仍无应答
+    uint32_t retries;
+    int32_t rssiSum;         // 除以 rxPackets 得平均 RSSI
+};
+
+class App433 : public RfRadio {
 public:
-    void init();
-    void loop(); 
+    // 在 Task433 里调用: 初始化芯片、装中断，登记内置解码器。SPI 起不来返回 false
+    bool init();
+    // 等中断通知 -> 读空 FIFO 进包队列 -> 逐包交给解码器
+    void loop();
+
+    // 追加解码器 (按登记顺序尝试)，满了返回 false
+    bool addDecoder(Rf433Decoder fn, void* ctx);
+
+    // 排队发一个要应答的请求 (CMD/POLL)，由 Task433 发送；队列满返回 false
+    bool post(uint8_t dst, RfType type, const uint8_t* payload, size_t n);
+
+    // 切换寄存器配置档 (在 Task433 里生效)，没有这个名字返回 false
+    bool setProfile(const char* name);
+    uint8_t profile() const { return _profile; }
+    // idx 档的统计，当前档的生效时间算到现在
+    void getProfileStats(uint8_t idx, Rf433ProfileStats* out);
+
+    // 串口命令: RF (统计) / RF=地址,十六进制负载 / RF_POLL=地址 / RF_PROFILE / RF_PROFILE=名字
+    bool handleSerial(const String& cmd);
+
+    void getStats(Cmt433Stats* out);
+
+    // RfRadio: 只在 Task433 里调用
+    bool send(const uint8_t* frame, size_t len) override;
+    bool receive(uint8_t* frame, uint32_t timeoutUs) override;
+    void defer(const uint8_t* frame) override;
+    uint32_t nowUs() override;
 
 private:
-    void RX_Init();
+    bool RX_Init();
     void RX_GoReceive();
-    
+    void drain();
+    bool readPacket(Rf433Packet& pkt);
+    void dispatch(const Rf433Packet& pkt);
+    void runPending();
+    void applyProfile(uint8_t idx);
+    void checkBitrate(uint32_t airUs, bool done);
+    void printProfiles();
+    static void IRAM_ATTR onPacketIsr();
+    static bool decodeToggle(const Rf433Packet& pkt, void* ctx);
+    static bool decodeLink(const Rf433Packet& pkt, void* ctx);
+    static size_t onLinkRequest(const RfFrame& req, uint8_t* reply, void* ctx);
+
     // 底层 SPI 函数
-    void delay_us(uint32_t n);
-    void cmt_spi_send(uint8_t data);
-    uint8_t cmt_spi_recv();
+    bool busInit();
     void writeReg(uint8_t addr, uint8_t data);
     uint8_t readReg(uint8_t addr);
+    // (地址, 值) 对的表，占着总线连续写
+    void writeRegs(const uint8_t* pairs, size_t count);
     void readFifo(uint8_t* buf, uint16_t len);
+    void writeFifo(const uint8_t* buf, uint16_t len);
+
+#if CMT_USE_BITBANG
+    void delay_us(uint32_t n);
+    void cmt_spi_send(uint8_t data);
+    uint8_t cmt_spi_recv();
+#else
+    spi_device_handle_t _regDev = NULL;    // CSB
+    spi_device_handle_t _fifoDev = NULL;   // FCSB
+#endif
+
+    TaskHandle_t _task = NULL;
+    bool _ready = false;         // 芯片已初始化
+    LockfreeRing<Rf433Packet, RF_PACKET_SLOTS> _packets;
+    struct TxRequest {
+        uint8_t dst;
+        uint8_t type;
+        uint8_t len;
+        uint8_t payload[RF_MAX_PAYLOAD];
+    };
+    LockfreeRing<TxRequest, RF_TX_SLOTS> _txQueue;
+    RfLink _link{*this, RF_SELF_ID, RfLinkConfig{CMT_BASE_BITRATE_BPS, RF_PREAMBLE_BYTES, RF_SYNC_BYTES, RF_RETRIES, RF_TURNAROUND_US}};
+    int8_t _lastRssi = 0;
+    uint8_t _profile = 0;
+    volatile int8_t _pendingProfile = -1;
+    uint32_t _profileSinceMs = 0;
+    Rf433ProfileStats _profileStats[CMT_PROFILE_COUNT] = {};
+    struct DecoderSlot {
+        Rf433Decoder fn;
+        void* ctx;
+    };
+    DecoderSlot _decoders[RF_MAX_DECODERS];
+    uint8_t _decoderCount = 0;
+    uint32_t _lastLogMs = 0;
+    uint32_t _logSkipped = 0;
+    Cmt433Stats _stats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 };
 
 extern App433 My433;
 
-#endif
\ No newline at end of file
+#endif
@@ -160,6 +160,12 @@ void App4G::powerOn() {
             Serial.println("[4G] AT Command OK!");
             _serial4G->println("ATE0"); // 关闭回显
             waitResponse("OK", 500); 
+            // NETSTATE 与屏幕背光 (PIN_TFT_BL) 共线的硬件上，关掉模组的网络灯输出后背光才交给 LEDC
+            if (LTE_NETLIGHT_OFF_CMD[0]) {
+                _serial4G->println(LTE_NETLIGHT_OFF_CMD);
+                _netLightOff = waitResponse("OK", 500);
+                if (!_netLightOff) Serial.println("[4G] Net light off command failed.");
+            }
         } else {
             Serial.println("[4G] Warning: Module responding but AT not OK.");
         }
@@ -169,6 +175,12 @@ void App4G::powerOn() {
 
     if (_modem == nullptr) _modem = new TinyGsm(*_serial4G);
     if (_client == nullptr) _client = new TinyGsmClient(*_modem);
+
+    if (synced) {
+        String imei = _modem->getIMEI();
+        strlcpy(_imei, imei.c_str(), sizeof(_imei));
+        Serial.printf("[4G] IMEI: %s\n", _imei[0] ? _imei : "(unknown)");
+    }
 }
 
 // [修复] 真正的连接检查逻辑
@@ -365,4 +377,8 @@ bool App4G::isConnected() { return _modem && _modem->isNetworkConnected(); }
 String App4G::getIMEI() { return _modem ? _modem->getIMEI() : ""; }
 TinyGsmClient& App4G::getClient() { return *_client; }
 void App4G::sendRawAT(String cmd) { _serial4G->println(cmd); }
-int App4G::getSignalCSQ() { return _modem ? _modem->getSignalQuality() : 0; }
\ No newline at end of file
+int App4G::getSignalCSQ() {
+    int csq = _modem ? _modem->getSignalQuality() : 0;
+    _lastCSQ = csq;
+    return csq;
+}
\ No newline at end of file
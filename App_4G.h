@@ -9,6 +9,13 @@
 #define TINY_GSM_MODEM_SIM7600 
 #include <TinyGsmClient.h>
 
+// 关掉模组网络灯 (NETSTATE) 输出的 AT 命令，只在 DISPLAY_BL_WAIT_NETLIGHT=1 的硬件上需要:
+// 那时 NETSTATE 与背光 (PIN_TFT_BL) 共线，模组回 OK 之后显示模块才接管这根线做 PWM 调光。
+// LE270/LE271 是 Fibocom 指令集，命令以模组 AT 手册为准；留空则不发送
+#ifndef LTE_NETLIGHT_OFF_CMD
+#define LTE_NETLIGHT_OFF_CMD ""
+#endif
+
 // 状态机状态定义
 enum RxState {
     ST_SEARCH,
@@ -24,9 +31,13 @@ public:
     bool connect(unsigned long timeout_ms = 30000L); 
     bool isConnected();
     String getIMEI();
+    // 开机时读到的 IMEI (powerOn 里查询一次)，没读到为空串
+    const char* getCachedIMEI() { return _imei; }
     TinyGsmClient& getClient(); 
     void sendRawAT(String cmd);
     int getSignalCSQ();
+    // 最近一次查询到的 CSQ (不发 AT，99 表示未知)
+    int getCachedCSQ() { return _lastCSQ; }
 
     // TCP 相关
     bool connectTCP(const char* host, uint16_t port);
@@ -44,12 +55,18 @@ public:
 
     HardwareSerial* getClientSerial() { return _serial4G; }
 
+    // 模组已确认关掉网络灯输出，背光线可以由本机驱动
+    bool netLightOff() { return _netLightOff; }
+
 private:
     HardwareSerial* _serial4G = &Serial2; 
     TinyGsm* _modem = nullptr;
     TinyGsmClient* _client = nullptr;
     String _apn = "cmiot";
     bool _is_verified = false;
+    volatile int _lastCSQ = 99;
+    volatile bool _netLightOff = false;
+    char _imei[20] = {0};
 
     // 状态机变量 (改为纯变量，无 String)
     RxState g_st = ST_SEARCH;
@@ -0,0 +1,275 @@
+#include "App_AC.h"
+#include <Preferences.h>
+#include "App_IR_Tx.h"
+
+AppAC MyAC;
+
+#define AC_NVS_NAMESPACE   "ac"
+#define AC_NVS_KEY         "state"
+#define AC_NVS_VERSION     1       // AcState 结构变了就加 1，旧数据丢弃
+
+struct AcBlob {
+    uint8_t version;
+    AcState state;
+};
+
+static const char* const kModeNames[AC_MODE_COUNT] = { "制冷", "制热", "除湿", "送风", "自动" };
+static const char* const kFanNames[AC_FAN_COUNT] = { "自动", "低", "中", "高" };
+static const char* const kModeKeys[AC_MODE_COUNT] = { "COOL", "HEAT", "DRY", "FAN", "AUTO" };
+static const char* const kFanKeys[AC_FAN_COUNT] = { "AUTO", "LOW", "MID", "HIGH" };
+
+static const QdhsMode kQdhsModes[AC_MODE_COUNT] = {
+    QDHS_MODE_COOL, QDHS_MODE_HEAT, QDHS_MODE_DRY, QDHS_MODE_FAN, QDHS_MODE_AUTO
+};
+static const QdhsFan kQdhsFans[AC_FAN_COUNT] = {
+    QDHS_FAN_AUTO, QDHS_FAN_LOW, QDHS_FAN_MID, QDHS_FAN_HIGH
+};
+
+static int clampTemp(int t) {
+    if (t < QDHS_TEMP_MIN) return QDHS_TEMP_MIN;
+    if (t > QDHS_TEMP_MAX) return QDHS_TEMP_MAX;
+    return t;
+}
+
+static int findName(const char* const* table, int n, const char* name) {
+    if (name == NULL) return -1;
+    for (int i = 0; i < n; i++) {
+        if (strcmp(table[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+void AppAC::init() {
+    Preferences prefs;
+    AcBlob blob;
+    if (prefs.begin(AC_NVS_NAMESPACE, true)) {
+        if (prefs.getBytes(AC_NVS_KEY, &blob, sizeof(blob)) == sizeof(blob) && blob.version == AC_NVS_VERSION &&
+            blob.state.mode < AC_MODE_COUNT && blob.state.fan < AC_FAN_COUNT) {
+            _state = blob.state;
+            _state.tempC = clampTemp(_state.tempC);
+        }
+        prefs.end();
+    }
+
+    esp_timer_create_args_t sendArgs = {};
+    sendArgs.callback = sendTimerCb;
+    sendArgs.arg = this;
+    sendArgs.name = "ac_send";
+    esp_timer_create(&sendArgs, &_sendTimer);
+
+    // 重启后不知道空调实际状态，下一次改动发完整帧
+    _sentValid = false;
+    printState();
+}
+
+// ================= 状态修改 =================
+// 改状态只在临界区里做，组帧发送推迟到定时器回调，写 NVS 推迟到 loop()
+void AppAC::update(Mutator fn, int arg) {
+    portENTER_CRITICAL(&_mux);
+    fn(_state, arg);
+    portEXIT_CRITICAL(&_mux);
+    scheduleSend();
+}
+
+void AppAC::setPower(bool on) {
+    update([](AcState& s, int v) { s.power = v != 0; }, on);
+}
+
+// 遥控器上调模式/温度/风速时空调会顺带开机，这里保持一致
+void AppAC::setMode(AcMode mode) {
+    if (mode >= AC_MODE_COUNT) return;
+    update([](AcState& s, int v) { s.mode = (AcMode)v; s.power = true; }, mode);
+}
+
+void AppAC::setTemp(int tempC) {
+    update([](AcState& s, int v) { s.tempC = clampTemp(v); s.power = true; }, tempC);
+}
+
+void AppAC::adjustTemp(int delta) {
+    update([](AcState& s, int v) { s.tempC = clampTemp(s.tempC + v); s.power = true; }, delta);
+}
+
+void AppAC::setFan(AcFan fan) {
+    if (fan >= AC_FAN_COUNT) return;
+    update([](AcState& s, int v) { s.fan = (AcFan)v; s.power = true; }, fan);
+}
+
+// 自动档之后从低档开始，不绕回
+void AppAC::adjustFan(int delta) {
+    update([](AcState& s, int v) {
+        int f = (s.fan == AC_FAN_AUTO) ? (v > 0 ? AC_FAN_LOW - 1 : AC_FAN_HIGH + 1) : s.fan;
+        f += v;
+        if (f < AC_FAN_LOW) f = AC_FAN_LOW;
+        if (f > AC_FAN_HIGH) f = AC_FAN_HIGH;
+        s.fan = (AcFan)f;
+        s.power = true;
+    }, delta);
+}
+
+void AppAC::toggleSwing() {
+    portENTER_CRITICAL(&_mux);
+    bool on = _state.power;
+    if (on) {
+        _state.swing = !_state.swing;
+        _pendingSwing++;
+    }
+    portEXIT_CRITICAL(&_mux);
+    if (on) scheduleSend();
+}
+
+AcState AppAC::getState() {
+    portENTER_CRITICAL(&_mux);
+    AcState s = _state;
+    portEXIT_CRITICAL(&_mux);
+    return s;
+}
+
+// ================= 发送 / 保存 =================
+void AppAC::scheduleSend() {
+    portENTER_CRITICAL(&_mux);
+    _saveDue = true;
+    _saveAtMs = millis() + AC_SAVE_DELAY_MS;
+    portEXIT_CRITICAL(&_mux);
+
+    if (_sendTimer == NULL) return;
+    esp_timer_stop(_sendTimer);   // 没在计时也没关系
+    esp_timer_start_once(_sendTimer, (uint64_t)AC_SEND_DEBOUNCE_MS * 1000);
+}
+
+void AppAC::sendTimerCb(void* arg) {
+    ((AppAC*)arg)->flush();
+}
+
+void AppAC::loop() {
+    portENTER_CRITICAL(&_mux);
+    bool due = _saveDue && (int32_t)(millis() - _saveAtMs) >= 0;
+    if (due) _saveDue = false;
+    portEXIT_CRITICAL(&_mux);
+    if (due) save();
+}
+
+// 合并窗口结束: 与上次发出的状态比较，只发有变化的部分。
+// 发送失败的部分不记为已发出，稍后重试；重试用完就当作不知道空调状态，下次发完整帧
+void AppAC::flush() {
+    portENTER_CRITICAL(&_mux);
+    AcState s = _state;
+    uint8_t swings = _pendingSwing;
+    _pendingSwing = 0;
+    portEXIT_CRITICAL(&_mux);
+
+    bool stateOk = true, swingOk = true;
+    if (!s.power) {
+        if (!_sentValid || _sent.power) {
+            Serial.println("[AC] -> OFF");
+            stateOk = MyIRTx.send<IrQdhs>(kQdhsOffPayload, QDHS_PAYLOAD_BYTES);
+        }
+    } else {
+        if (!_sentValid || !_sent.power || _sent.mode != s.mode || _sent.tempC != s.tempC || _sent.fan != s.fan) {
+            QdhsCommand cmd = { kQdhsModes[s.mode], s.tempC, kQdhsFans[s.fan] };
+            uint8_t payload[QDHS_PAYLOAD_BYTES];
+            qdhsBuildPayload(cmd, payload);
+            Serial.printf("[AC] -> %s %dC fan %s\n", kModeNames[s.mode], s.tempC, kFanNames[s.fan]);
+            stateOk = MyIRTx.send<IrQdhs>(payload, QDHS_PAYLOAD_BYTES);
+        }
+        // 摆风是切换码，偶数次切换相互抵消；状态帧没发出去时先不发，免得顺序乱
+        if ((swings & 1) && stateOk) {
+            Serial.printf("[AC] -> swing %s\n", s.swing ? "on" : "off");
+            swingOk = MyIRTx.send<IrQdhs>(kQdhsSwingPayload, QDHS_PAYLOAD_BYTES);
+        }
+    }
+
+    if (stateOk) {
+        _sent = s;
+        _sentValid = true;
+    }
+    if (stateOk && swingOk) {
+        _sendRetries = 0;
+        return;
+    }
+
+    // 没发出去的摆风切换放回去，与这期间新的切换合并
+    portENTER_CRITICAL(&_mux);
+    _pendingSwing += swings;
+    portEXIT_CRITICAL(&_mux);
+    if (++_sendRetries > AC_SEND_RETRIES) {
+        Serial.println("[AC] IR send failed, giving up");
+        _sendRetries = 0;
+        _sentValid = false;
+        portENTER_CRITICAL(&_mux);
+        _pendingSwing = 0;
+        portEXIT_CRITICAL(&_mux);
+        return;
+    }
+    if (_sendTimer) esp_timer_start_once(_sendTimer, (uint64_t)AC_SEND_RETRY_MS * 1000);
+}
+
+void AppAC::save() {
+    AcBlob blob;
+    memset(&blob, 0, sizeof(blob));
+    blob.version = AC_NVS_VERSION;
+    blob.state = getState();
+
+    Preferences prefs;
+    if (!prefs.begin(AC_NVS_NAMESPACE, false)) {
+        Serial.println("[AC] NVS open failed");
+        return;
+    }
+    prefs.putBytes(AC_NVS_KEY, &blob, sizeof(blob));
+    prefs.end();
+}
+
+// ================= 指令入口 =================
+void AppAC::applyVoice(const char* action, int temp, int tempDelta, const char* mode, const char* fan) {
+    if (action && (strcmp(action, "关闭") == 0 || strcmp(action, "关") == 0)) {
+        setPower(false);
+        return;
+    }
+    if (action && (strcmp(action, "打开") == 0 || strcmp(action, "开") == 0)) setPower(true);
+
+    int m = findName(kModeNames, AC_MODE_COUNT, mode);
+    if (m >= 0) setMode((AcMode)m);
+    int f = findName(kFanNames, AC_FAN_COUNT, fan);
+    if (f >= 0) setFan((AcFan)f);
+
+    if (temp > 0) setTemp(temp);
+    else if (tempDelta != 0) adjustTemp(tempDelta);
+}
+
+bool AppAC::handleSerial(const String& cmd) {
+    if (cmd != "AC" && !cmd.startsWith("AC=")) return false;
+    if (cmd == "AC") {
+        printState();
+        return true;
+    }
+
+    String arg = cmd.substring(3);
+    arg.toUpperCase();
+    int idx;
+    if (arg == "ON") setPower(true);
+    else if (arg == "OFF") setPower(false);
+    else if (arg == "SWING") toggleSwing();
+    else if (arg.startsWith("T")) setTemp(arg.substring(1).toInt());
+    else if (arg.startsWith("+") || arg.startsWith("-")) adjustTemp(arg.toInt());
+    else if (arg.startsWith("FAN:") && (idx = findName(kFanKeys, AC_FAN_COUNT, arg.c_str() + 4)) >= 0) setFan((AcFan)idx);
+    else if ((idx = findName(kModeKeys, AC_MODE_COUNT, arg.c_str())) >= 0) setMode((AcMode)idx);
+    else {
+        Serial.println("[AC] Usage: AC | AC=ON|OFF|T24|+1|-1|COOL|HEAT|DRY|FAN|AUTO|FAN:AUTO|LOW|MID|HIGH|SWING");
+        return true;
+    }
+    printState();
+    return true;
+}
+
+void AppAC::printState() {
+    AcState s = getState();
+    Serial.printf("[AC] %s, %s, %dC, fan %s, swing %s\n", s.power ? "ON" : "OFF",
+                  kModeKeys[s.mode], s.tempC, kFanKeys[s.fan], s.swing ? "on" : "off");
+}
+
+const char* AppAC::modeName(AcMode mode) {
+    return mode < AC_MODE_COUNT ? kModeNames[mode] : "";
+}
+
+const char* AppAC::fanName(AcFan fan) {
+    return fan < AC_FAN_COUNT ? kFanNames[fan] : "";
+}
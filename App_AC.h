@@ -0,0 +1,100 @@
+/**
+ * @file App_AC.h
+ * @brief 空调状态模型: 本机记录电源/模式/温度/风速/摆风，改动后本地组帧发送
+ * @details
+ * 语音指令、串口 AC= 命令都只改这里的状态 (可以是 "升高 2 度"、"风大一点" 这样的增量)，
+ * 不再依赖服务端下发的十六进制码，没有网络也能控制。
+ * 短时间内的多次改动合并成一帧 (AC_SEND_DEBOUNCE_MS)，与上次发出的状态相同就不发；
+ * 红外发送失败 (发送池忙) 时隔 AC_SEND_RETRY_MS 重试，成功之前不算已发出。
+ * 状态延迟写入 NVS (AC_SAVE_DELAY_MS)，重启后恢复；写 Flash 在 TaskSys 的 loop() 里做，
+ * 不占用 esp_timer 任务 (LVGL tick、按键消抖都在那里)。
+ * 任何任务都可以调用。
+ */
+#ifndef APP_AC_H
+#define APP_AC_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include "Ir_Protocol.h"
+
+#define AC_SEND_DEBOUNCE_MS   250
+#define AC_SEND_RETRY_MS      100      // 红外发送池忙时的重试间隔
+#define AC_SEND_RETRIES       10
+#define AC_SAVE_DELAY_MS      5000     // NVS 写入合并，减少 Flash 擦写
+
+enum AcMode : uint8_t {
+    AC_MODE_COOL = 0,
+    AC_MODE_HEAT,
+    AC_MODE_DRY,
+    AC_MODE_FAN,
+    AC_MODE_AUTO,
+    AC_MODE_COUNT
+};
+
+enum AcFan : uint8_t {
+    AC_FAN_AUTO = 0,
+    AC_FAN_LOW,
+    AC_FAN_MID,
+    AC_FAN_HIGH,
+    AC_FAN_COUNT
+};
+
+struct AcState {
+    bool power;
+    AcMode mode;
+    uint8_t tempC;
+    AcFan fan;
+    bool swing;      // 遥控器的摆风是切换码，这里记录推测的当前状态
+};
+
+class AppAC {
+public:
+    // 从 NVS 读出上次的状态
+    void init();
+    // 到时间就把状态写入 NVS，由 TaskSys 周期调用
+    void loop();
+
+    void setPower(bool on);
+    void setMode(AcMode mode);
+    void setTemp(int tempC);
+    void adjustTemp(int delta);
+    void setFan(AcFan fan);
+    void adjustFan(int delta);
+    void toggleSwing();
+
+    // 语音指令: action = 打开/关闭/调节，params 里的字段可以为空
+    // tempDelta 是相对调整 ("高一点" = +1)，与 temp 同时给出时以 temp 为准
+    void applyVoice(const char* action, int temp, int tempDelta, const char* mode, const char* fan);
+
+    // 串口命令: AC / AC=ON / AC=OFF / AC=T24 / AC=+1 / AC=COOL / AC=FAN:HIGH / AC=SWING
+    bool handleSerial(const String& cmd);
+
+    AcState getState();
+    void printState();
+
+    static const char* modeName(AcMode mode);
+    static const char* fanName(AcFan fan);
+
+private:
+    typedef void (*Mutator)(AcState& s, int arg);
+    void update(Mutator fn, int arg);
+    void scheduleSend();
+    void flush();
+    void save();
+    static void sendTimerCb(void* arg);
+
+    AcState _state = { false, AC_MODE_COOL, QDHS_TEMP_DEFAULT, AC_FAN_AUTO, false };
+    AcState _sent = { false, AC_MODE_COOL, 0, AC_FAN_AUTO, false };   // 最近一次发出去的状态
+    bool _sentValid = false;
+    uint8_t _pendingSwing = 0;        // 待发送的摆风切换次数
+    uint8_t _sendRetries = 0;
+    bool _saveDue = false;
+    uint32_t _saveAtMs = 0;
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+    esp_timer_handle_t _sendTimer = NULL;
+};
+
+extern AppAC MyAC;
+
+#endif
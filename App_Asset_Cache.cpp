@@ -0,0 +1,204 @@
+#include "App_Asset_Cache.h"
+#include "Asset_Lz4.h"
+
+// 主机上的 UI 基准 (tools/ui_bench) 也会编译本文件
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#else
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#endif
+
+// 一条缓存: (owner, id) 唯一标识一个资源，字体 owner = 字体包，图片 owner = 图片数据
+struct AssetEntry {
+    const void *owner;
+    uint32_t id;
+    uint8_t *data;
+    uint32_t size;
+    uint32_t lastUse;
+    uint16_t pins;       // 图片被 LVGL 打开期间不能淘汰
+};
+
+static AssetEntry s_entries[ASSET_CACHE_ENTRIES];
+static uint32_t s_useClock = 0;
+static asset_cache_stats_t s_stats;
+
+static void *asset_malloc(size_t size) {
+#ifdef ARDUINO
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (p != NULL) return p;
+#endif
+    return malloc(size);
+}
+
+static int64_t asset_now_us() {
+#ifdef ARDUINO
+    return esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+static void entry_free(AssetEntry *e) {
+    s_stats.bytes_used -= e->size;
+    s_stats.evictions++;
+    free(e->data);
+    memset(e, 0, sizeof(*e));
+}
+
+// 淘汰最久没用、且没被钉住的条目，直到能放下 need 字节并有空槽
+static AssetEntry *make_room(uint32_t need) {
+    for (;;) {
+        AssetEntry *freeSlot = NULL;
+        AssetEntry *lru = NULL;
+        for (int i = 0; i < ASSET_CACHE_ENTRIES; i++) {
+            AssetEntry *e = &s_entries[i];
+            if (e->data == NULL) {
+                if (!freeSlot) freeSlot = e;
+            } else if (e->pins == 0 && (!lru || e->lastUse < lru->lastUse)) {
+                lru = e;
+            }
+        }
+        bool fits = (s_stats.bytes_used + need <= ASSET_CACHE_BYTES);
+        if (freeSlot && fits) return freeSlot;
+        // 剩下的都被钉住了：超出预算也照样分配，保证显示正确
+        if (lru == NULL) return freeSlot;
+        entry_free(lru);
+    }
+}
+
+static AssetEntry *lookup(const void *owner, uint32_t id, const uint8_t *packed, uint32_t packedLen, uint32_t rawLen) {
+    for (int i = 0; i < ASSET_CACHE_ENTRIES; i++) {
+        AssetEntry *e = &s_entries[i];
+        if (e->data && e->owner == owner && e->id == id) {
+            e->lastUse = ++s_useClock;
+            s_stats.hits++;
+            return e;
+        }
+    }
+
+    s_stats.misses++;
+    AssetEntry *slot = make_room(rawLen);
+    if (slot == NULL) return NULL;
+
+    uint8_t *buf = (uint8_t *)asset_malloc(rawLen);
+    if (buf == NULL) return NULL;
+
+    int64_t t0 = asset_now_us();
+    int n = asset_lz4_decode(packed, packedLen, buf, rawLen);
+    s_stats.decode_us += (uint32_t)(asset_now_us() - t0);
+    if (n != (int)rawLen) {
+        LV_LOG_WARN("asset_cache: corrupt data (%d/%u)", n, (unsigned)rawLen);
+        free(buf);
+        return NULL;
+    }
+
+    slot->owner = owner;
+    slot->id = id;
+    slot->data = buf;
+    slot->size = rawLen;
+    slot->lastUse = ++s_useClock;
+    slot->pins = 0;
+    s_stats.bytes_used += rawLen;
+    if (s_stats.bytes_used > s_stats.bytes_peak) s_stats.bytes_peak = s_stats.bytes_used;
+    return slot;
+}
+
+// ================= 字体 =================
+// 返回的指针在下一次解压之前有效 (LVGL 画完一个字形才会取下一个)
+const uint8_t * asset_font_get_bitmap(const lv_font_t * font, uint32_t unicode_letter) {
+    static const uint8_t empty = 0;
+    const asset_font_pack_t *pack = (const asset_font_pack_t *)font->user_data;
+    if (pack == NULL) return NULL;
+
+    // 按 unicode 二分查找
+    int lo = 0, hi = (int)pack->glyph_cnt - 1;
+    const asset_glyph_t *g = NULL;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        uint32_t u = pack->glyphs[mid].unicode;
+        if (u == unicode_letter) { g = &pack->glyphs[mid]; break; }
+        if (u < unicode_letter) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    if (g == NULL) return NULL;
+    if (g->raw_len == 0) return &empty;   // 空格之类没有位图
+
+    AssetEntry *e = lookup(pack, unicode_letter, pack->data + g->offset, g->packed_len, g->raw_len);
+    return e ? e->data : NULL;
+}
+
+// ================= 图片 =================
+// 数据数组不保证 4 字节对齐，头部用 memcpy 读
+static bool img_hdr(const void *src, asset_img_hdr_t *hdr) {
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return false;
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+    if (img->header.cf != LV_IMG_CF_USER_ENCODED_0) return false;
+    if (img->data_size < sizeof(asset_img_hdr_t)) return false;
+    memcpy(hdr, img->data, sizeof(asset_img_hdr_t));
+    return hdr->magic == ASSET_IMG_MAGIC;
+}
+
+static lv_res_t img_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header) {
+    LV_UNUSED(decoder);
+    asset_img_hdr_t hdr;
+    if (!img_hdr(src, &hdr)) return LV_RES_INV;
+
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+    header->always_zero = 0;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->cf = hdr.cf;   // 报告真实格式，绘制时按原格式处理解压后的数据
+    return LV_RES_OK;
+}
+
+static lv_res_t img_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc) {
+    LV_UNUSED(decoder);
+    asset_img_hdr_t hdr;
+    if (!img_hdr(dsc->src, &hdr)) return LV_RES_INV;
+
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)dsc->src;
+    AssetEntry *e = lookup(img->data, 0, img->data + sizeof(asset_img_hdr_t),
+                           img->data_size - sizeof(asset_img_hdr_t), hdr.raw_size);
+    if (e == NULL) return LV_RES_INV;
+
+    // LVGL 的图片缓存会一直持有 img_data，直到 close
+    e->pins++;
+    dsc->img_data = e->data;
+    dsc->user_data = e;
+    return LV_RES_OK;
+}
+
+static void img_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc) {
+    LV_UNUSED(decoder);
+    AssetEntry *e = (AssetEntry *)dsc->user_data;
+    if (e && e->pins > 0) e->pins--;
+    dsc->user_data = NULL;
+    dsc->img_data = NULL;
+}
+
+void asset_cache_init(void) {
+    memset(s_entries, 0, sizeof(s_entries));
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    lv_img_decoder_t *dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, img_info);
+    lv_img_decoder_set_open_cb(dec, img_open);
+    lv_img_decoder_set_close_cb(dec, img_close);
+}
+
+void asset_cache_get_stats(asset_cache_stats_t * out) {
+    if (out) *out = s_stats;
+}
+
+void asset_cache_reset_stats(void) {
+    uint32_t used = s_stats.bytes_used;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.bytes_used = used;
+    s_stats.bytes_peak = used;
+}
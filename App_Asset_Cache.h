@@ -0,0 +1,83 @@
+/**
+ * @file App_Asset_Cache.h
+ * @brief 压缩资源 (字体字形 / 图片) 的按需解压缓存
+ * @details
+ * 字体和图片由 tools/asset_pack/asset_pack.py 改写成 LZ4 压缩数组：
+ *  - 字体: .get_glyph_bitmap = asset_font_get_bitmap，.user_data 指向 asset_font_pack_t
+ *  - 图片: .header.cf = LV_IMG_CF_USER_ENCODED_0，数据前 12 字节是 asset_img_hdr_t
+ * 解压结果放在有上限的 PSRAM 缓存里 (LRU)，统计命中/未命中。
+ * 所有接口只能在 UI 任务 (LVGL 所在任务) 里调用。
+ * ui_font_*.c 是 C 文件，所以这里是 C 接口。
+ */
+#ifndef APP_ASSET_CACHE_H
+#define APP_ASSET_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined __has_include
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+#elif __has_include("lvgl/lvgl.h")
+#include "lvgl/lvgl.h"
+#else
+#include "lvgl.h"
+#endif
+#else
+#include "lvgl.h"
+#endif
+
+#define ASSET_CACHE_BYTES     (16 * 1024)   // 解压缓存总上限
+#define ASSET_CACHE_ENTRIES   48
+
+#define ASSET_IMG_MAGIC       0x314B5041    // "APK1" (小端)
+
+// 一个压缩字形，按 unicode 升序排列
+typedef struct {
+    uint32_t unicode;
+    uint32_t offset;     // 在压缩数组里的偏移
+    uint16_t packed_len;
+    uint16_t raw_len;
+} asset_glyph_t;
+
+typedef struct {
+    const asset_glyph_t *glyphs;
+    uint32_t glyph_cnt;
+    const uint8_t *data;
+} asset_font_pack_t;
+
+// 压缩图片数据头 (后面紧跟 LZ4 块)
+typedef struct {
+    uint32_t magic;
+    uint8_t cf;          // 解压后的真实颜色格式
+    uint8_t reserved[3];
+    uint32_t raw_size;
+} asset_img_hdr_t;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bytes_used;
+    uint32_t bytes_peak;
+    uint32_t decode_us;  // 累计解压耗时
+} asset_cache_stats_t;
+
+// 注册图片解码器，需在 lv_init() 之后、ui_init() 之前调用
+void asset_cache_init(void);
+
+// 字体回调 (给 lv_font_t.get_glyph_bitmap 用)
+const uint8_t * asset_font_get_bitmap(const lv_font_t * font, uint32_t unicode_letter);
+
+void asset_cache_get_stats(asset_cache_stats_t * out);
+void asset_cache_reset_stats(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif
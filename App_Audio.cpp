@@ -6,6 +6,7 @@
 #include "Pin_Config.h" 
 #include "AudioTools.h"
 #include "AudioBoard.h"
+#include "Adpcm_Codec.h"
 
 AppAudio MyAudio;
 
@@ -109,6 +110,18 @@ void AppAudio::pushToPlayBuffer(uint8_t* data, size_t len) {
     }
 }
 
+void AppAudio::setStreamRate(uint32_t rate) {
+    // 只支持 I2S 采样率的整数分频
+    if (rate == 0 || rate > AUDIO_SAMPLE_RATE || AUDIO_SAMPLE_RATE % rate != 0) rate = AUDIO_SAMPLE_RATE;
+    if (rate != streamRate) Serial.printf("[Audio] Stream rate: %d Hz\n", rate);
+    streamRate = rate;
+}
+
+size_t AppAudio::getPlayBufferFree() {
+    if (playRingBuf == NULL) return 0;
+    return xRingbufferGetCurFreeSize(playRingBuf);
+}
+
 // [核心] 兼容旧接口 - 直接调用 push
 void AppAudio::playChunk(uint8_t* data, size_t len) {
     pushToPlayBuffer(data, len);
@@ -137,113 +150,6 @@ void AppAudio::playStream(Client* client, int length) {
     }
 }
 
-// ==========================================
-//  IMA ADPCM Helper (Tables & Structs)
-// ==========================================
-const int8_t index_table[16] = {
-    -1, -1, -1, -1, 2, 4, 6, 8,
-    -1, -1, -1, -1, 2, 4, 6, 8
-};
-
-const int step_size_table[89] = {
-    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
-    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
-    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
-    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
-    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
-    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
-    2272, 2499, 2749, 3024, 3326, 3658, 4024, 4428, 4871, 5358,
-    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
-    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
-};
-
-struct AdpcmState {
-    int32_t valprev;
-    int8_t index;
-};
-
-// ==========================================
-//  IMA ADPCM Decoder
-// ==========================================
-int16_t adpcm_decode(uint8_t code, AdpcmState *state) {
-    int step = step_size_table[state->index];
-    int diffq = step >> 3;
-    if (code & 4) diffq += step;
-    if (code & 2) diffq += (step >> 1);
-    if (code & 1) diffq += (step >> 2);
-    
-    if (code & 8) state->valprev -= diffq;
-    else state->valprev += diffq;
-    
-    if (state->valprev > 32767) state->valprev = 32767;
-    else if (state->valprev < -32768) state->valprev = -32768;
-    
-    state->index += index_table[code];
-    if (state->index < 0) state->index = 0;
-    if (state->index > 88) state->index = 88;
-    
-    return (int16_t)state->valprev;
-}
-
-// ==========================================
-//  IMA ADPCM Encoder
-// ==========================================
-uint8_t adpcm_encode(int16_t sample1, int16_t sample2, AdpcmState *state) {
-    uint8_t code = 0;
-    
-    // Sample 1
-    int diff = sample1 - state->valprev;
-    int sign = (diff < 0) ? 8 : 0;
-    if (diff < 0) diff = -diff;
-    
-    int step = step_size_table[state->index];
-    int delta = 0;
-    int vpdiff = (step >> 3);
-    
-    if (diff >= step) { delta |= 4; diff -= step; vpdiff += step; }
-    if (diff >= (step >> 1)) { delta |= 2; diff -= (step >> 1); vpdiff += (step >> 1); }
-    if (diff >= (step >> 2)) { delta |= 1; vpdiff += (step >> 2); }
-    
-    if (sign) state->valprev -= vpdiff;
-    else state->valprev += vpdiff;
-    
-    if (state->valprev > 32767) state->valprev = 32767;
-    else if (state->valprev < -32768) state->valprev = -32768;
-    
-    state->index += index_table[delta | sign];
-    if (state->index < 0) state->index = 0;
-    if (state->index > 88) state->index = 88;
-    
-    code = (delta | sign); // Low nibble
-
-    // Sample 2
-    diff = sample2 - state->valprev;
-    sign = (diff < 0) ? 8 : 0;
-    if (diff < 0) diff = -diff;
-    
-    step = step_size_table[state->index];
-    delta = 0;
-    vpdiff = (step >> 3);
-    
-    if (diff >= step) { delta |= 4; diff -= step; vpdiff += step; }
-    if (diff >= (step >> 1)) { delta |= 2; diff -= (step >> 1); vpdiff += (step >> 1); }
-    if (diff >= (step >> 2)) { delta |= 1; vpdiff += (step >> 2); }
-    
-    if (sign) state->valprev -= vpdiff;
-    else state->valprev += vpdiff;
-    
-    if (state->valprev > 32767) state->valprev = 32767;
-    else if (state->valprev < -32768) state->valprev = -32768;
-    
-    state->index += index_table[delta | sign];
-    if (state->index < 0) state->index = 0;
-    if (state->index > 88) state->index = 88;
-    
-    code |= ((delta | sign) << 4); // High nibble
-    
-    return code;
-}
-
 void AppAudio::startRecording() {
     if (isRecording) return;
     if (!record_buffer) return;
@@ -283,15 +189,10 @@ void AppAudio::_recordTask(void *param) {
             int16_t* pcm_samples = (int16_t*)temp_buf;
             
             // 确保我们有足够的空间
-            if (record_data_len + (sample_count / 2) < MAX_RECORD_SIZE) {
+            if (record_data_len + (sample_count + 1) / 2 < MAX_RECORD_SIZE) {
                 
-                for (size_t i = 0; i < sample_count; i += 2) {
-                     int16_t s1 = pcm_samples[i];
-                     int16_t s2 = (i + 1 < sample_count) ? pcm_samples[i+1] : 0;
-                     
-                     uint8_t code = adpcm_encode(s1, s2, &rec_state);
-                     record_buffer[record_data_len++] = code;
-                }
+                record_data_len += adpcm_encode_block(pcm_samples, sample_count,
+                                                      record_buffer + record_data_len, &rec_state);
             } else {
                  isRecording = false; // 缓冲满
                  Serial.println("[Audio] Rec Buffer Full!");
@@ -337,19 +238,22 @@ void audioPlayTask(void *param) {
             }
             last_audio_time = millis();
 
+            // 低码率流 (如 8k) 每个采样重复写入，补齐到 I2S 的 16k
+            int repeat = AUDIO_SAMPLE_RATE / audio->getStreamRate();
+
             // Decode Loop
             for (size_t i = 0; i < item_size; i++) {
                 uint8_t byte = item[i];
                 
                 // Sample 1 (Low Nibble)
-                int16_t s1 = adpcm_decode(byte & 0x0F, &state);
+                int16_t s1 = adpcm_decode_sample(byte & 0x0F, &state);
                 out_pcm_stereo[0] = s1; out_pcm_stereo[1] = s1;
-                i2s.write((uint8_t*)out_pcm_stereo, 4);
+                for (int r = 0; r < repeat; r++) i2s.write((uint8_t*)out_pcm_stereo, 4);
 
                 // Sample 2 (High Nibble)
-                int16_t s2 = adpcm_decode((byte >> 4) & 0x0F, &state);
+                int16_t s2 = adpcm_decode_sample((byte >> 4) & 0x0F, &state);
                 out_pcm_stereo[0] = s2; out_pcm_stereo[1] = s2;
-                i2s.write((uint8_t*)out_pcm_stereo, 4);
+                for (int r = 0; r < repeat; r++) i2s.write((uint8_t*)out_pcm_stereo, 4);
             }
             
             vRingbufferReturnItem(audio->playRingBuf, (void *)item);
@@ -35,6 +35,12 @@ public: // === 这里的变量和函数都是公开的 ===
     void playChunk(uint8_t* data, size_t len);
     void pushToPlayBuffer(uint8_t* data, size_t len);
 
+    // [自适应码率] 下行 ADPCM 的采样率 (服务端按链路选择 16000 / 8000)，播放时补齐到 I2S 的 16k
+    void setStreamRate(uint32_t rate);
+    uint32_t getStreamRate() { return streamRate; }
+    // 播放缓冲剩余空间 (字节)，随请求头报给服务端做发送节奏控制
+    size_t getPlayBufferFree();
+
     // 录音内部任务
     void _recordTask(void *param);
 
@@ -49,6 +55,7 @@ private: // === 私有变量 ===
     TaskHandle_t recordTaskHandle = NULL;
     volatile bool isRecording = false;
     TaskHandle_t playTaskHandle = NULL;
+    volatile uint32_t streamRate = AUDIO_SAMPLE_RATE;
 };
 
 extern AppAudio MyAudio;
@@ -0,0 +1,131 @@
+#include "App_Bus.h"
+#include <esp_timer.h>
+
+AppBus MyBus;
+
+int AppBus::subscribe(const char* name, uint32_t topicMask) {
+    int id = -1;
+    portENTER_CRITICAL(&_subMux);
+    uint8_t n = _subCount.load(std::memory_order_relaxed);
+    if (n < BUS_MAX_SUBSCRIBERS) {
+        Subscriber& s = _subs[n];
+        s.name = name;
+        s.mask = topicMask;
+        s.task = xTaskGetCurrentTaskHandle();
+        s.received = 0;
+        s.lastLatencyUs = 0;
+        s.maxLatencyUs = 0;
+        s.sumLatencyUs = 0;
+        _subCount.store(n + 1, std::memory_order_release);   // 填好再发布，发布者不会看到半个订阅者
+        id = n;
+    }
+    portEXIT_CRITICAL(&_subMux);
+
+    if (id < 0) Serial.printf("[Bus] 订阅者已满，%s 没有登记上\n", name);
+    return id;
+}
+
+bool AppBus::publish(BusTopic topic, uint8_t kind, int32_t param, const void* data, size_t len) {
+    if (topic >= BUS_TOPIC_COUNT) return false;
+    BusEvent evt;
+    evt.topic = topic;
+    evt.kind = kind;
+    evt.param = param;
+    evt.len = (uint8_t)(len > BUS_DATA_MAX ? BUS_DATA_MAX : len);
+    if (data && evt.len) memcpy(evt.data, data, evt.len);
+    evt.stampUs = (uint32_t)esp_timer_get_time();
+    _published[topic]++;
+
+    bool heard = false, ok = true;
+    uint8_t n = _subCount.load(std::memory_order_acquire);
+    for (uint8_t i = 0; i < n; i++) {
+        Subscriber& s = _subs[i];
+        if (!(s.mask & BUS_BIT(topic))) continue;
+        heard = true;
+        if (s.ring.push(evt)) {
+            xTaskNotifyGive(s.task);
+        } else {
+            _dropped[topic]++;
+            ok = false;
+        }
+    }
+    if (!heard) _unheard[topic]++;
+    return heard && ok;
+}
+
+// 拷贝 UTF-8 文本，截断时退回到完整字符边界
+bool AppBus::publishText(BusTopic topic, uint8_t kind, int32_t param, const char* text) {
+    if (!text) return publish(topic, kind, param);
+    size_t n = strlen(text);
+    if (n >= BUS_DATA_MAX) {
+        n = BUS_DATA_MAX - 1;
+        while (n > 0 && ((uint8_t)text[n] & 0xC0) == 0x80) n--;
+    }
+    char buf[BUS_DATA_MAX];
+    memcpy(buf, text, n);
+    buf[n] = '\0';
+    return publish(topic, kind, param, buf, n + 1);
+}
+
+bool AppBus::poll(int sub, BusEvent& out) {
+    if (sub < 0 || sub >= _subCount.load(std::memory_order_acquire)) return false;
+    Subscriber& s = _subs[sub];
+    if (!s.ring.pop(out)) return false;
+
+    uint32_t lat = (uint32_t)esp_timer_get_time() - out.stampUs;
+    s.received++;
+    s.lastLatencyUs = lat;
+    if (lat > s.maxLatencyUs) s.maxLatencyUs = lat;
+    s.sumLatencyUs += lat;
+    return true;
+}
+
+bool AppBus::getSubscriberStats(int sub, BusSubscriberStats* out) {
+    if (!out || sub < 0 || sub >= _subCount.load(std::memory_order_acquire)) return false;
+    const Subscriber& s = _subs[sub];
+    out->name = s.name;
+    out->mask = s.mask;
+    out->received = s.received;
+    out->dropped = s.ring.dropped();
+    out->lastLatencyUs = s.lastLatencyUs;
+    out->maxLatencyUs = s.maxLatencyUs;
+    out->sumLatencyUs = s.sumLatencyUs;
+    return true;
+}
+
+void AppBus::printStats() {
+    Serial.println("[Bus] 主题       发布   丢弃  无人订阅");
+    for (uint8_t t = 0; t < BUS_TOPIC_COUNT; t++) {
+        Serial.printf("      %-10s %6u %6u %6u\n", topicName(t), (unsigned)_published[t].load(),
+                      (unsigned)_dropped[t].load(), (unsigned)_unheard[t].load());
+    }
+    Serial.println("[Bus] 订阅者     收到   丢弃  延迟 us (最近/平均/最大)");
+    uint8_t n = _subCount.load(std::memory_order_acquire);
+    for (uint8_t i = 0; i < n; i++) {
+        BusSubscriberStats st;
+        getSubscriberStats(i, &st);
+        Serial.printf("      %-10s %6u %6u  %u / %u / %u\n", st.name, (unsigned)st.received, (unsigned)st.dropped,
+                      (unsigned)st.lastLatencyUs, (unsigned)(st.received ? st.sumLatencyUs / st.received : 0),
+                      (unsigned)st.maxLatencyUs);
+    }
+}
+
+bool AppBus::handleSerial(const String& cmd) {
+    if (cmd != "BUS") return false;
+    printStats();
+    return true;
+}
+
+const char* AppBus::topicName(uint8_t topic) {
+    switch (topic) {
+        case BUS_KEY:      return "KEY";
+        case BUS_UI:       return "UI";
+        case BUS_REMOTE:   return "REMOTE";
+        case BUS_AUDIO:    return "AUDIO";
+        case BUS_RECORDED: return "RECORDED";
+        case BUS_NET:      return "NET";
+        case BUS_IR:       return "IR";
+        case BUS_IR_LEARN: return "IR_LEARN";
+        default:           return "?";
+    }
+}
@@ -0,0 +1,136 @@
+/**
+ * @file App_Bus.h
+ * @brief 任务间事件总线: 定长事件 + 每个订阅者一个无锁环形队列，按主题过滤
+ * @details
+ * 订阅者在自己的任务里 subscribe，登记任务句柄和关心的主题 (位掩码)，
+ * 事件槽全部静态分配。publish 把事件拷进每个匹配订阅者的 LockfreeRing，
+ * 再用任务通知唤醒它；不分配内存、不加锁、不阻塞，队列满只丢给这个订阅者的这一条并计数。
+ * 订阅者醒来后 poll 读空，poll 时按事件里的发布时间统计分发延迟。
+ * 事件负载最多 BUS_DATA_MAX 字节；长数据 (AI 回复文字、录音) 仍在模块自己的缓冲里，
+ * 事件只做通知。publish 只能在任务里调用，中断里仍用任务通知。
+ * 串口 BUS 打印每个主题的发布/丢弃数和每个订阅者的延迟。
+ */
+#ifndef APP_BUS_H
+#define APP_BUS_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+#include "Lockfree_Ring.h"
+
+#define BUS_DATA_MAX         48     // 放得下一个 IREvent
+#define BUS_RING_SLOTS       16
+#define BUS_MAX_SUBSCRIBERS  6
+#define BUS_BIT(t)           (1u << (t))
+
+enum BusTopic : uint8_t {
+    BUS_KEY,         // 按键: kind = KeyAction                       Sys -> UI
+    BUS_UI,          // UI 命令: kind = UICmdType, param              任意 -> UI
+    BUS_REMOTE,      // 433 遥控: kind = RemoteKey, param = RSSI      433 -> UI
+    BUS_AUDIO,       // 音频控制: kind = AudioCmd                     UI -> Audio
+    BUS_RECORDED,    // 录音已停止: param = 录音字节数                 Audio -> UI
+    BUS_NET,         // 网络请求: kind = NetRequest                   UI -> Net
+    BUS_IR,          // 红外接收: kind = IrProtoId, 负载 = IREvent     IRRx -> IR
+    BUS_IR_LEARN,    // 红外学习请求: 文本 = 码名                      任意 -> IR
+    BUS_TOPIC_COUNT
+};
+
+enum AudioCmd : uint8_t {
+    AUDIO_TONE,       // 负载 = AudioTone
+    AUDIO_REC_START,
+    AUDIO_REC_STOP    // 停完发 BUS_RECORDED
+};
+
+struct AudioTone {
+    uint16_t freq;
+    uint16_t ms;
+};
+
+enum NetRequest : uint8_t {
+    NET_UPLOAD_AUDIO  // 上传录音，和服务器对话
+};
+
+enum RemoteKey : uint8_t {
+    REMOTE_TOGGLE     // 切换背光
+};
+
+// 定长、可平凡拷贝
+struct BusEvent {
+    uint8_t topic;
+    uint8_t kind;
+    uint8_t len;              // data 的有效字节数
+    int32_t param;
+    uint32_t stampUs;         // 发布时间 (esp_timer 低 32 位)
+    uint8_t data[BUS_DATA_MAX];
+};
+
+struct BusSubscriberStats {
+    const char* name;
+    uint32_t mask;
+    uint32_t received;
+    uint32_t dropped;         // 自己的队列满
+    uint32_t lastLatencyUs;   // 发布到 poll 取出
+    uint32_t maxLatencyUs;
+    uint64_t sumLatencyUs;
+};
+
+class AppBus {
+public:
+    // 在订阅者自己的任务里调用，返回订阅号；满了返回 -1
+    int subscribe(const char* name, uint32_t topicMask);
+
+    // 任意任务可调用；有订阅者且全部投递成功返回 true
+    bool publish(BusTopic topic, uint8_t kind, int32_t param = 0, const void* data = NULL, size_t len = 0);
+
+    // 文本负载，超长时按 UTF-8 字符边界截断
+    bool publishText(BusTopic topic, uint8_t kind, int32_t param, const char* text);
+
+    // 结构体负载
+    template <class T>
+    bool publishPayload(BusTopic topic, uint8_t kind, const T& payload) {
+        static_assert(sizeof(T) <= BUS_DATA_MAX, "payload too large for a bus slot");
+        static_assert(std::is_trivially_copyable<T>::value, "payload must be trivially copyable");
+        return publish(topic, kind, 0, &payload, sizeof(T));
+    }
+
+    template <class T>
+    static bool payload(const BusEvent& evt, T& out) {
+        if (evt.len != sizeof(T)) return false;
+        memcpy(&out, evt.data, sizeof(T));
+        return true;
+    }
+
+    // 只能由订阅者自己的任务调用
+    bool poll(int sub, BusEvent& out);
+
+    bool getSubscriberStats(int sub, BusSubscriberStats* out);
+    void printStats();
+
+    // 串口命令: BUS
+    bool handleSerial(const String& cmd);
+
+    static const char* topicName(uint8_t topic);
+
+private:
+    struct Subscriber {
+        const char* name;
+        uint32_t mask;
+        TaskHandle_t task;
+        LockfreeRing<BusEvent, BUS_RING_SLOTS> ring;
+        uint32_t received;
+        uint32_t lastLatencyUs;
+        uint32_t maxLatencyUs;
+        uint64_t sumLatencyUs;
+    };
+
+    Subscriber _subs[BUS_MAX_SUBSCRIBERS];
+    std::atomic<uint8_t> _subCount{0};
+    portMUX_TYPE _subMux = portMUX_INITIALIZER_UNLOCKED;
+    std::atomic<uint32_t> _published[BUS_TOPIC_COUNT] = {};
+    std::atomic<uint32_t> _dropped[BUS_TOPIC_COUNT] = {};       // 某个订阅者队列满
+    std::atomic<uint32_t> _unheard[BUS_TOPIC_COUNT] = {};       // 没有订阅者
+};
+
+extern AppBus MyBus;
+
+#endif
@@ -1,68 +1,311 @@
 #include "App_Display.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include "App_Asset_Cache.h"
+#include "App_Screen_Manager.h"
+#include "App_4G.h"
 
 AppDisplay MyDisplay;
 
-// 定义全局锁变量
-SemaphoreHandle_t xGuiSemaphore = NULL;
-
 static const uint16_t screenWidth  = 128;
 static const uint16_t screenHeight = 128;
 static lv_disp_draw_buf_t draw_buf;
-static lv_color_t buf[ screenWidth * screenHeight / 10 ];
+
+// 分配失败时的兜底缓冲 (单缓冲 + 阻塞刷屏)
+static lv_color_t fallback_buf[ screenWidth * screenHeight / 10 ];
+
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY  27000000
+#endif
+
+static DisplayStats s_stats;
 
 TFT_eSPI tft = TFT_eSPI(); 
 
 void AppDisplay::my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
+    uint32_t px = w * h;
+
+    s_stats.flushes++;
+    s_stats.pixels += px;
+    s_stats.spiBusyUs += (uint64_t)px * 16 * 1000000ULL / SPI_FREQUENCY;
+
+    if (MyDisplay._dmaEnabled) {
+        // 上一块还在 DMA 中时，先等它结束再改地址窗口
+        int64_t t0 = esp_timer_get_time();
+        tft.dmaWait();
+        s_stats.dmaWaitUs += esp_timer_get_time() - t0;
+
+        tft.setAddrWindow(area->x1, area->y1, w, h);
+        tft.pushPixelsDMA((uint16_t *)&color_p->full, px);
+
+        // 双缓冲: LVGL 接着往另一块里画；这一块要到下一次 flush 的 dmaWait 之后才会被复用
+        lv_disp_flush_ready(disp);
+        return;
+    }
 
     tft.startWrite();
     tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushColors((uint16_t *)&color_p->full, w * h, true);
+    tft.pushColors((uint16_t *)&color_p->full, px, true);
     tft.endWrite();
 
     lv_disp_flush_ready(disp); 
 }
 
+void AppDisplay::my_disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+    s_stats.frames++;
+    s_stats.lastFrameMs = time;
+    s_stats.lastFramePx = px;
+    if (time > s_stats.maxFrameMs) s_stats.maxFrameMs = time;
+}
+
+void AppDisplay::getStats(DisplayStats* out) {
+    if (out) *out = s_stats;
+}
+
+void AppDisplay::resetStats() {
+    memset(&s_stats, 0, sizeof(s_stats));
+    _statsWindowStart = millis();
+}
+
+void AppDisplay::logStats() {
+    uint32_t window = millis() - _statsWindowStart;
+    if (window < 10000) return;
+    if (s_stats.frames > 0) {
+        Serial.printf("[Display] %u frames/%us, last %ums max %ums, SPI %u%%, DMA wait %ums\n",
+                      s_stats.frames, window / 1000, s_stats.lastFrameMs, s_stats.maxFrameMs,
+                      (uint32_t)(s_stats.spiBusyUs / 10 / window), (uint32_t)(s_stats.dmaWaitUs / 1000));
+
+        asset_cache_stats_t ac;
+        asset_cache_get_stats(&ac);
+        if (ac.hits + ac.misses > 0) {
+            Serial.printf("[Display] Asset cache: %u hit / %u miss, %u evicted, %u B (peak %u), decode %u us\n",
+                          ac.hits, ac.misses, ac.evictions, ac.bytes_used, ac.bytes_peak, ac.decode_us);
+        }
+        asset_cache_reset_stats();
+    }
+    resetStats();
+}
+
+// ================= 背光与熄屏 =================
+#if DISPLAY_BL_WAIT_NETLIGHT
+static_assert(sizeof(LTE_NETLIGHT_OFF_CMD) > 1, "DISPLAY_BL_WAIT_NETLIGHT needs LTE_NETLIGHT_OFF_CMD");
+#endif
+
+// 等模组网络灯时本机先不输出，亮度只记下来
+void AppDisplay::initBacklight() {
+    _blOwned = false;
+    _ledcReady = false;
+#if DISPLAY_BL_WAIT_NETLIGHT
+    pinMode(PIN_TFT_BL, INPUT);
+#else
+    claimBacklight();
+#endif
+}
+
+// 接上 LEDC，按当前亮度输出
+void AppDisplay::claimBacklight() {
+    ledc_timer_config_t timer = {};
+    timer.speed_mode = LEDC_LOW_SPEED_MODE;
+    timer.duty_resolution = BL_PWM_BITS;
+    timer.timer_num = BL_LEDC_TIMER;
+    timer.freq_hz = BL_PWM_FREQ_HZ;
+    timer.clk_cfg = LEDC_AUTO_CLK;
+
+    ledc_channel_config_t ch = {};
+    ch.gpio_num = PIN_TFT_BL;
+    ch.speed_mode = LEDC_LOW_SPEED_MODE;
+    ch.channel = BL_LEDC_CHANNEL;
+    ch.intr_type = LEDC_INTR_DISABLE;
+    ch.timer_sel = BL_LEDC_TIMER;
+    ch.duty = 0;
+    ch.hpoint = 0;
+
+    if (ledc_timer_config(&timer) == ESP_OK && ledc_channel_config(&ch) == ESP_OK) {
+        ledc_fade_func_install(0);
+        _ledcReady = true;
+    } else {
+        pinMode(PIN_TFT_BL, OUTPUT);
+        Serial.println("[Display] LEDC init failed, backlight on/off only.");
+    }
+    _blOwned = true;
+    setBrightness(_brightness, 0);
+}
+
+void AppDisplay::setBrightness(uint8_t pct, uint32_t fadeMs) {
+    if (pct > 100) pct = 100;
+    _brightness = pct;
+    if (!_blOwned) return;
+    if (!_ledcReady) {
+        digitalWrite(PIN_TFT_BL, pct > 0 ? HIGH : LOW);
+        return;
+    }
+    // 平方曲线，人眼感觉上的亮度更接近线性
+    const uint32_t maxDuty = (1u << BL_PWM_BITS) - 1;
+    uint32_t duty = maxDuty * pct * pct / 10000;
+    if (fadeMs == 0) {
+        ledc_set_duty(LEDC_LOW_SPEED_MODE, BL_LEDC_CHANNEL, duty);
+        ledc_update_duty(LEDC_LOW_SPEED_MODE, BL_LEDC_CHANNEL);
+    } else {
+        // 上一次渐变没结束时这里会等它结束 (最多 BL_FADE_MS)
+        ledc_set_fade_with_time(LEDC_LOW_SPEED_MODE, BL_LEDC_CHANNEL, duty, fadeMs);
+        ledc_fade_start(LEDC_LOW_SPEED_MODE, BL_LEDC_CHANNEL, LEDC_FADE_NO_WAIT);
+    }
+}
+
+// ST7735 睡眠: 关显示 + SLPIN，显存内容保留，唤醒后不需要重画
+void AppDisplay::panelSleep(bool enter) {
+    if (_dmaEnabled) tft.dmaWait();   // DMA 模式下事务常开，writecommand 直接复用
+    if (enter) {
+        tft.writecommand(TFT_DISPOFF);
+        tft.writecommand(TFT_SLPIN);
+    } else {
+        tft.writecommand(TFT_SLPOUT);
+        vTaskDelay(pdMS_TO_TICKS(120));   // SLPOUT 之后至少 120ms 才能发下一条命令
+        tft.writecommand(TFT_DISPON);
+    }
+}
+
+void AppDisplay::sleep() {
+    if (isAsleep()) return;
+    setBrightness(0);
+    _fadeDoneMs = millis() + BL_FADE_MS;
+    _power = DISP_FADING_OUT;
+    Serial.println("[Display] Sleep");
+}
+
+bool AppDisplay::noteActivity() {
+    _lastActivityMs = millis();
+    DisplayPower prev = _power;
+    if (prev == DISP_ON) return false;
+
+    if (prev == DISP_SLEEP) panelSleep(false);
+    _power = DISP_ON;
+    setBrightness(BL_LEVEL_ON, prev == DISP_DIM ? BL_FADE_MS : BL_FADE_MS / 2);
+    if (prev != DISP_DIM) Serial.println("[Display] Wake");
+    return prev != DISP_DIM;
+}
+
 void AppDisplay::toggleBacklight() {
-    _backlightState = !_backlightState;
-    digitalWrite(PIN_TFT_BL, _backlightState ? HIGH : LOW);
-    Serial.printf("[Display] Backlight set to %s\n", _backlightState ? "ON" : "OFF");
+    if (isAsleep()) noteActivity();
+    else sleep();
+}
+
+// 无操作计时: 亮 -> 暗 -> 渐灭 -> 面板睡眠
+void AppDisplay::updatePower() {
+#if DISPLAY_BL_WAIT_NETLIGHT
+    if (!_blOwned && My4G.netLightOff()) claimBacklight();
+#endif
+    if (!_blOwned) return;   // 背光还没接管: 不调光也不熄屏
+
+    uint32_t now = millis();
+    uint32_t idle = now - _lastActivityMs;
+    switch (_power) {
+        case DISP_ON:
+        case DISP_DIM:
+            if (DISPLAY_SLEEP_AFTER_MS > 0 && idle >= DISPLAY_SLEEP_AFTER_MS) {
+                sleep();
+            } else if (_power == DISP_ON && DISPLAY_DIM_AFTER_MS > 0 && idle >= DISPLAY_DIM_AFTER_MS) {
+                setBrightness(BL_LEVEL_DIM);
+                _power = DISP_DIM;
+            }
+            break;
+        case DISP_FADING_OUT:
+            if ((int32_t)(now - _fadeDoneMs) >= 0) {
+                panelSleep(true);
+                _power = DISP_SLEEP;
+            }
+            break;
+        case DISP_SLEEP:
+            break;
+    }
 }
 
 void AppDisplay::init() {
     gpio_reset_pin((gpio_num_t)3); 
     pinMode(3, OUTPUT); 
     
-    xGuiSemaphore = xSemaphoreCreateMutex();
+    _uiTask = xTaskGetCurrentTaskHandle();
 
-    pinMode(PIN_TFT_BL, OUTPUT);
-    digitalWrite(PIN_TFT_BL, HIGH);
-    _backlightState = true;
+    initBacklight();
+    setBrightness(BL_LEVEL_ON, 0);
+    _power = DISP_ON;
+    _lastActivityMs = millis();
 
     tft.begin();
     tft.setRotation(0);
     tft.fillScreen(TFT_BLACK);
 
     lv_init();
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, screenWidth * screenHeight / 10);
+    asset_cache_init();   // 压缩字体/图片的解码器，必须在构建屏幕之前
+
+    // 双缓冲放内部 DMA RAM；整屏缓冲分不到时退回 1/10 屏
+    const uint32_t bufCaps = MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL;
+    const uint32_t smallPixels = screenWidth * screenHeight / 10;
+    uint32_t bufPixels = DISPLAY_FULL_FRAME ? screenWidth * screenHeight : smallPixels;
+    lv_color_t *buf1 = (lv_color_t *)heap_caps_malloc(bufPixels * sizeof(lv_color_t), bufCaps);
+    lv_color_t *buf2 = (lv_color_t *)heap_caps_malloc(bufPixels * sizeof(lv_color_t), bufCaps);
+    if ((!buf1 || !buf2) && bufPixels != smallPixels) {
+        if (buf1) heap_caps_free(buf1);
+        if (buf2) heap_caps_free(buf2);
+        bufPixels = smallPixels;
+        buf1 = (lv_color_t *)heap_caps_malloc(bufPixels * sizeof(lv_color_t), bufCaps);
+        buf2 = (lv_color_t *)heap_caps_malloc(bufPixels * sizeof(lv_color_t), bufCaps);
+    }
+
+    if (buf1 && buf2 && tft.initDMA()) {
+        _dmaEnabled = true;
+        tft.setSwapBytes(true);  // pushPixelsDMA 按 _swapBytes 交换字节，等同于 pushColors(..., true)
+        tft.startWrite();        // DMA 模式下保持 SPI 事务常开
+        lv_disp_draw_buf_init(&draw_buf, buf1, buf2, bufPixels);
+        Serial.printf("[Display] DMA double buffer: 2 x %u px\n", bufPixels);
+    } else {
+        if (buf1) heap_caps_free(buf1);
+        if (buf2) heap_caps_free(buf2);
+        lv_disp_draw_buf_init(&draw_buf, fallback_buf, NULL, screenWidth * screenHeight / 10);
+        Serial.println("[Display] DMA unavailable, using single blocking buffer.");
+    }
 
     static lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res = screenWidth;
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = my_disp_flush;
+    disp_drv.monitor_cb = my_disp_monitor;
     disp_drv.draw_buf = &draw_buf;
     lv_disp_drv_register(&disp_drv);
 
-    ui_init(); 
+    MyScreens.init();     // 只构建主屏，其它屏幕首次进入时再构建
+    resetStats();
+    _lastTickUs = esp_timer_get_time();
 
-    Serial.println("[Display] UI Started with FreeRTOS Mutex.");
+    Serial.println("[Display] UI Started.");
 }
 
-void AppDisplay::loop() {
-    if (xSemaphoreTake(xGuiSemaphore, portMAX_DELAY) == pdTRUE) {
-        lv_timer_handler(); 
-        xSemaphoreGive(xGuiSemaphore);
+// 用 esp_timer 的实际流逝时间推进 LVGL 时钟，不足 1ms 的余数留到下次
+void AppDisplay::updateTick() {
+#if LV_TICK_CUSTOM == 0
+    int64_t now = esp_timer_get_time();
+    int64_t elapsedMs = (now - _lastTickUs) / 1000;
+    if (elapsedMs > 0) {
+        lv_tick_inc((uint32_t)elapsedMs);
+        _lastTickUs += elapsedMs * 1000;
     }
-}
\ No newline at end of file
+#endif
+}
+
+void AppDisplay::wake() {
+    if (_uiTask) xTaskNotifyGive(_uiTask);
+}
+
+uint32_t AppDisplay::loop() {
+    updateTick();
+    updatePower();
+    // 熄屏时不跑 LVGL 也不动 SPI，界面的改动攒到亮屏后一次画出
+    if (_power == DISP_SLEEP) return UINT32_MAX;
+
+    uint32_t next = lv_timer_handler(); 
+    logStats();
+    return next;
+}
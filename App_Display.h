@@ -9,24 +9,106 @@
 
 // 引入 FreeRTOS
 #include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h> 
+#include <freertos/task.h>
+#include <driver/ledc.h>
+
+// [刷屏缓冲] 两块缓冲都在内部 DMA RAM (SPI DMA 不从 PSRAM 取数)，传输一块时 LVGL 渲染另一块
+//            0: 1/10 屏 (2 x 3.2KB)
+//            1: 整屏，每次刷新只需一个分块 (2 x 32KB)；内部 RAM 分不到时退回 1/10 屏
+#ifndef DISPLAY_FULL_FRAME
+#define DISPLAY_FULL_FRAME  0
+#endif
+
+// [背光] LEDC PWM 调光，开机就驱动 PIN_TFT_BL (与原来的常高电平一样点亮)。
+// 这根线在板上还接着 4G 的 NETSTATE；硬件改成由模组驱动时设 DISPLAY_BL_WAIT_NETLIGHT 为 1:
+// 开机保持高阻，My4G 关掉网络灯输出 (LTE_NETLIGHT_OFF_CMD 回 OK) 之后才接上 LEDC，
+// 在那之前不调光也不熄屏
+#ifndef DISPLAY_BL_WAIT_NETLIGHT
+#define DISPLAY_BL_WAIT_NETLIGHT  0
+#endif
+#define BL_LEDC_TIMER      LEDC_TIMER_3
+#define BL_LEDC_CHANNEL    LEDC_CHANNEL_7     // 避开 Arduino tone()/ledcSetup 常用的低编号通道
+#define BL_PWM_FREQ_HZ     20000              // 高于听觉范围，避免背光升压电路啸叫
+#define BL_PWM_BITS        LEDC_TIMER_10_BIT
+#define BL_LEVEL_ON        100                // 正常亮度 (%)
+#define BL_LEVEL_DIM       30                 // 无操作后的暗屏亮度 (%)
+#define BL_FADE_MS         400
+
+// [熄屏] 无操作多久后变暗 / 熄屏 (0 = 不启用)。熄屏时面板进入 SLPIN，LVGL 暂停
+#ifndef DISPLAY_DIM_AFTER_MS
+#define DISPLAY_DIM_AFTER_MS    30000
+#endif
+#ifndef DISPLAY_SLEEP_AFTER_MS
+#define DISPLAY_SLEEP_AFTER_MS  90000
+#endif
+
+enum DisplayPower {
+    DISP_ON,
+    DISP_DIM,
+    DISP_FADING_OUT,    // 背光正在渐灭，结束后面板进入睡眠
+    DISP_SLEEP
+};
+
+// 刷屏统计 (只在 UI 任务里更新)
+struct DisplayStats {
+    uint32_t frames;        // LVGL 完成的刷新次数
+    uint32_t flushes;       // flush_cb 调用次数 (一次刷新可能分多块)
+    uint32_t lastFrameMs;   // 最近一次刷新的渲染+刷屏耗时
+    uint32_t maxFrameMs;
+    uint32_t lastFramePx;   // 最近一次刷新的像素数
+    uint64_t pixels;        // 累计推送像素
+    uint64_t spiBusyUs;     // 按 SPI 时钟估算的累计传输时间
+    uint64_t dmaWaitUs;     // flush 中等待上一次 DMA 完成的累计时间
+};
 
 class AppDisplay {
 public:
     void init();
-    void loop(); 
+    // 运行一次 LVGL，返回距下一个 LVGL 定时器到期的毫秒数
+    // LVGL 只允许在 UI 任务里调用，其它任务通过 MyUILogic 投递命令
+    uint32_t loop(); 
+
+    // 唤醒 UI 任务 (其它任务改了界面或投递了事件后调用)
+    void wake();
     
-    // [新增] 切换背光函数
+    // 切换熄屏/亮屏 (433 遥控)
     void toggleBacklight();
 
+    // 用户操作: 重置无操作计时，变暗或熄屏时恢复。只在 UI 任务里调用
+    // 返回 true 表示屏幕原本是熄灭的 (这次按键只用来亮屏)
+    bool noteActivity();
+    // 立即渐灭背光并让面板睡眠
+    void sleep();
+    bool isAsleep() { return _power == DISP_FADING_OUT || _power == DISP_SLEEP; }
+    // 背光亮度 0~100%，fadeMs = 0 时立即生效
+    void setBrightness(uint8_t pct, uint32_t fadeMs = BL_FADE_MS);
+
+    // 刷屏统计
+    void getStats(DisplayStats* out);
+    void resetStats();
+
 private:
     static void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p);
+    static void my_disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px);
+    void logStats();
+    void updateTick();
+    void initBacklight();
+    void claimBacklight();
+    void updatePower();
+    void panelSleep(bool enter);
     
-    // [新增] 记录背光状态，默认是开
-    bool _backlightState = true; 
+    DisplayPower _power = DISP_ON;
+    bool _blOwned = false;      // 背光线已由本机驱动
+    bool _ledcReady = false;
+    uint8_t _brightness = 0;
+    uint32_t _lastActivityMs = 0;
+    uint32_t _fadeDoneMs = 0;
+    bool _dmaEnabled = false;
+    uint32_t _statsWindowStart = 0;
+    int64_t _lastTickUs = 0;
+    TaskHandle_t _uiTask = NULL;
 };
 
 extern AppDisplay MyDisplay;
-extern SemaphoreHandle_t xGuiSemaphore;
 
-#endif
\ No newline at end of file
+#endif
@@ -1,31 +1,23 @@
 #include "App_IR.h"
+#include "App_AC.h"
+#include "App_IR_Library.h"
 
 AppIR MyIR;
 
-const uint16_t kCaptureBufferSize = 1024; 
-const uint8_t kTimeout = 20; 
-
-extern QueueHandle_t IRQueue_Handle; 
-
-// 1. 全局只保留 ac 对象，它会独占管理 PIN_IR_TX
+// ac 对象只用来组装 Electra 的状态字节，不调用 begin()/send()，
+// PIN_IR_TX 由 MyIRTx 的 RMT 通道独占
 IRElectraAc ac(PIN_IR_TX); 
 
 void AppIR::init() {
     Serial.println("[IR] Initializing...");
 
-    // --- 接收部分 (不变) ---
-    _irRecv = new IRrecv(PIN_IR_RX, kCaptureBufferSize, kTimeout, true);
-    _irRecv->enableIRIn(); 
+    // --- 接收部分: RMT 接收任务解码，事件经总线通知本任务 ---
+    _busSub = MyBus.subscribe("IR", BUS_BIT(BUS_IR) | BUS_BIT(BUS_IR_LEARN));
+    MyIRRx.init(xTaskGetCurrentTaskHandle());
 
-    // --- 发送部分 (关键修改) ---
-    // [删除] 不要在这里 new IRsend，会和 ac 对象冲突！
-    // _irSend = new IRsend(PIN_IR_TX);
-    // _irSend->begin(); 
+    // --- 发送部分 ---
+    MyIRTx.init();
 
-    // 初始化空调对象 (它会自动初始化 RMT 驱动)
-    Serial.println("IR: Initializing Electra AC...");
-    ac.begin(); 
-    
     // 初始化默认状态
     ac.off();
     ac.setFan(kElectraAcFanAuto);
@@ -52,22 +44,22 @@ void App_IR_Control_AC(bool power, uint8_t temp)
         ac.off();
     }
 
-    // 2. 设置模式
-    ac.setMode(kElectraAcCool);
+    // 2. 模式和风速跟随 MyAC 记录的状态
+    static const uint8_t kModes[AC_MODE_COUNT] = { kElectraAcCool, kElectraAcHeat, kElectraAcDry, kElectraAcFan, kElectraAcAuto };
+    static const uint8_t kFans[AC_FAN_COUNT] = { kElectraAcFanAuto, kElectraAcFanLow, kElectraAcFanMed, kElectraAcFanHigh };
+    AcState st = MyAC.getState();
+    ac.setMode(kModes[st.mode]);
 
     // 3. 设置风速
-    ac.setFan(kElectraAcFanAuto);
+    ac.setFan(kFans[st.fan]);
 
     // 4. 设置温度
     ac.setTemp(temp);
 
     // 5. 发送信号
-    ac.send();
-    
-    // 恢复接收
-    // _irRecv->enableIRIn();
+    MyIRTx.send<IrElectra>(ac.getRaw(), kElectraAcStateLength);
 
-    Serial.println("IR: Signal Sent (Electra Protocol)!");
+    Serial.println("IR: Signal Queued (Electra Protocol)!");
     Serial.println(ac.toString().c_str()); 
 }
 
@@ -78,151 +70,78 @@ void App_IR_Test_Send(void)
 }
 
 void AppIR::loop() {
-    if (_irRecv->decode(&_results)) {
-        // [新增] 打印详细的原始数据，用于分析未知协议
-        Serial.println("----------------------------------------------------------------");
-        Serial.printf("[IR] Signal Detected. Protocol: %s, Bits: %d\n", 
-                      typeToString(_results.decode_type).c_str(), _results.bits);
-        
-        // 打印原始时序数据 (Source Code 格式，可以直接复制用来发送)
-        String rawCode = resultToSourceCode(&_results);
-        Serial.println("--- Raw Source Code (cpp) ---");
-        Serial.println(rawCode);
-        
-        // 打印人类可读的时序信息
-        String timingInfo = resultToTimingInfo(&_results);
-         Serial.println("--- Timing Info ---");
-        Serial.println(timingInfo);
-        
-        Serial.println("----------------------------------------------------------------");
-
-        if (_results.value != kRepeat) {
-            IREvent evt;
-            memset(&evt, 0, sizeof(IREvent));
-            evt.protocol = _results.decode_type;
-            evt.bits = _results.bits;
-            evt.value = _results.value;
-            evt.isAC = false;
-
-            if (_results.decode_type == COOLIX || _results.bits > 64) {
-                evt.isAC = true;
-                int byteCount = _results.bits / 8;
-                if (_results.bits % 8 != 0) byteCount++; 
-                if (byteCount > IR_STATE_SIZE) byteCount = IR_STATE_SIZE; 
-                for (int i = 0; i < byteCount; i++) evt.state[i] = _results.state[i];
-                // Serial.printf("[IR] AC Signal Detected (Protocol: %s)\n", typeToString(_results.decode_type).c_str());
-            } else {
-                // Serial.printf("[IR] Normal Signal: 0x%llX\n", _results.value);
-            }
-            if (IRQueue_Handle != NULL) xQueueSend(IRQueue_Handle, &evt, 0);
-        } 
-        _irRecv->resume(); 
+    ulTaskNotifyTake(pdTRUE, MyIRRx.learning() ? pdMS_TO_TICKS(IR_LEARN_POLL_MS) : portMAX_DELAY);
+
+    BusEvent msg;
+    IREvent evt;
+    while (MyBus.poll(_busSub, msg)) {
+        if (msg.topic == BUS_IR_LEARN) {
+            MyIRLib.beginLearn((const char*)msg.data);
+            continue;
+        }
+        if (!AppBus::payload(msg, evt)) continue;
+        char hex[IR_STATE_SIZE * 2 + 1];
+        for (uint8_t i = 0; i < evt.len; i++) snprintf(hex + i * 2, 3, "%02X", evt.data[i]);
+        hex[evt.len * 2] = '\0';
+        Serial.printf("[IR] RX %s (%u symbols) %s\n", AppIRRx::protoName(evt.protocol), evt.symbols, hex);
+        if (evt.flags) MyIRLib.onEvent(evt);
     }
+    MyIRLib.checkTimeout();
 }
 
-// 修改后的 sendNEC：为了兼容性，临时创建一个 sender
 void AppIR::sendNEC(uint32_t data) {
     Serial.printf("[IR] Sending NEC: 0x%08X\n", data);
-    
-    // 临时创建一个 sender 来发送 NEC，避免全局冲突
-    // 注意：频繁创建销毁开销较大，但对于偶尔控制灯是没问题的
-    IRsend tempSender(PIN_IR_TX);
-    tempSender.begin();
-    tempSender.sendNEC(data, 32);
-    
-    // 发送完 NEC 后，必须重新初始化 AC 对象，否则 AC 下次可能发不出信号
-    // 因为 tempSender 销毁时可能会重置引脚状态
-    ac.begin(); 
-
-    vTaskDelay(pdMS_TO_TICKS(20)); 
-    _irRecv->enableIRIn(); 
+    MyIRTx.sendNEC(data);
 }
 
 void AppIR::sendCoolix(uint32_t data) {
-    // 同样的逻辑
-    IRsend tempSender(PIN_IR_TX);
-    tempSender.begin();
-    tempSender.sendCOOLIX(data);
-    ac.begin(); // 恢复 AC 驱动
-    
-    vTaskDelay(pdMS_TO_TICKS(50)); 
-    _irRecv->enableIRIn(); 
-    Serial.println("[IR] Coolix Sent.");
+    Serial.printf("[IR] Sending Coolix: 0x%06X\n", data);
+    MyIRTx.sendCoolix(data);
+}
+
+static int hexVal(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
 }
 
 // [新增] 实现 QD-HS6324 协议发送
 // 参数: hexStr 例如 "B24DA05FD02F"
 void AppIR::sendQDHSString(String hexStr) {
-    if (hexStr.length() == 0 || hexStr.length() % 2 != 0) {
+    int len = hexStr.length() / 2;
+    if (hexStr.length() == 0 || hexStr.length() % 2 != 0 || len > IR_STATE_SIZE) {
         Serial.println("[IR] Error: Invalid Hex String");
         return;
     }
 
     Serial.printf("[IR] Sending QD-HS6324 Raw: %s\n", hexStr.c_str());
 
-    // 1. 解析 Hex 串 -> Bytes
-    int len = hexStr.length() / 2;
-    uint8_t* dataBytes = (uint8_t*)malloc(len);
+    uint8_t frame[IR_STATE_SIZE];
     for (int i = 0; i < len; i++) {
-        char high = hexStr[i * 2];
-        char low = hexStr[i * 2 + 1];
-        
-        uint8_t hVal = (high >= 'A') ? (high - 'A' + 10) : (high - '0');
-        if (high >= 'a') hVal = high - 'a' + 10; // 支持小写
-        
-        uint8_t lVal = (low >= 'A') ? (low - 'A' + 10) : (low - '0');
-        if (low >= 'a') lVal = low - 'a' + 10;
-        
-        dataBytes[i] = (hVal << 4) | lVal;
+        int h = hexVal(hexStr[i * 2]);
+        int l = hexVal(hexStr[i * 2 + 1]);
+        if (h < 0 || l < 0) {
+            Serial.println("[IR] Error: Invalid Hex String");
+            return;
+        }
+        frame[i] = (uint8_t)((h << 4) | l);
     }
 
-    // 2. 构造 Raw Buffer
-    // 协议时序 (us):
-    // Leader: 4350, 4350
-    // 0: 580, 580
-    // 1: 580, 1580
-    // Stop: 580, 5290 (仅在多帧中间用，这里暂定单帧)
-    // End: 580 (Header Mark for shutdown? No, it's trail mark)
-    // 实际: 单帧 = Leader + Data + EndMark (580us)
-    
-    // 计算 buffer size: Header(2) + Bits(len*8)*2 + Footer(1)
-    // uint16_t bufferSize = 2 + len * 8 * 2 + 1; 
-    // 使用 vector 或 dynamic array
-    uint16_t* rawBuf = new uint16_t[200]; // 够用就行
-    int idx = 0;
-
-    // A. Leader
-    rawBuf[idx++] = 4350;
-    rawBuf[idx++] = 4350;
-
-    // B. Data
-    for (int i = 0; i < len; i++) {
-        for (int b = 7; b >= 0; b--) { // MSB First
-            rawBuf[idx++] = 580; // Mark
-            if ((dataBytes[i] >> b) & 1) {
-                rawBuf[idx++] = 1580; // Space for 1
-            } else {
-                rawBuf[idx++] = 580;  // Space for 0
-            }
-        }
+    // 帧 = 负载字节各带反码，校验后按负载重新编码
+    uint8_t payload[IR_STATE_SIZE];
+    size_t n = IrQdhs::parseFrame(frame, len, payload);
+    if (n == 0) {
+        Serial.println("[IR] Error: QD-HS frame complement mismatch");
+        return;
     }
+    MyIRTx.send<IrQdhs>(payload, n);
+}
 
-    // C. End Mark
-    rawBuf[idx++] = 580; 
-
-    // 3. 发送
-    IRsend tempSender(PIN_IR_TX);
-    tempSender.begin();
-    tempSender.sendRaw(rawBuf, idx, 38); // 38kHz
-
-    // 4. 清理
-    delete[] rawBuf;
-    free(dataBytes);
-
-    // 5. 恢复 AC
-    ac.begin();
-    vTaskDelay(pdMS_TO_TICKS(50));
-    _irRecv->enableIRIn();
-    
-    Serial.println("[IR] QD-HS6324 Sent.");
-}
\ No newline at end of file
+void AppIR::sendQDHS(const QdhsCommand& cmd) {
+    uint8_t payload[QDHS_PAYLOAD_BYTES];
+    qdhsBuildPayload(cmd, payload);
+    Serial.printf("[IR] Sending QD-HS6324: mode %X, %d C, fan %02X -> %02X %02X %02X\n",
+                  cmd.mode, cmd.tempC, cmd.fan, payload[0], payload[1], payload[2]);
+    MyIRTx.send<IrQdhs>(payload, QDHS_PAYLOAD_BYTES);
+}
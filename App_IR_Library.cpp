@@ -0,0 +1,229 @@
+#include "App_IR_Library.h"
+#include <Preferences.h>
+#include <nvs.h>
+#include "App_IR_Tx.h"
+#include "App_Bus.h"
+
+AppIRLibrary MyIRLib;
+
+// 条目: [名字长度][名字][压缩码]
+#define IR_LIB_RECORD_MAX  (1 + IR_LIB_NAME_MAX + IR_LIB_CODE_MAX)
+
+static bool openLib(Preferences& prefs, bool readOnly) {
+    return prefs.begin(IR_LIB_NAMESPACE, readOnly, IR_LIB_PARTITION);
+}
+
+static void makeKey(uint32_t hash, int probe, char* key) {
+    snprintf(key, 12, "c%08lx", (unsigned long)(hash + probe * 0x9E3779B9u));
+}
+
+// 读出条目，返回压缩码的偏移 (0 = 不存在或损坏)
+static size_t readRecord(Preferences& prefs, const char* key, uint8_t* rec, size_t* len) {
+    *len = prefs.getBytes(key, rec, IR_LIB_RECORD_MAX);
+    if (*len < 2 || rec[0] == 0 || rec[0] >= IR_LIB_NAME_MAX || 1u + rec[0] >= *len) return 0;
+    return 1 + rec[0];
+}
+
+bool AppIRLibrary::findKey(const char* name, char* key, char* freeKey) {
+    Preferences prefs;
+    freeKey[0] = '\0';
+    if (!openLib(prefs, true)) {   // 命名空间还不存在: 第一个位置就是空位
+        makeKey(irNameHash(name), 0, freeKey);
+        return false;
+    }
+
+    uint32_t hash = irNameHash(name);
+    size_t nameLen = strlen(name);
+    uint8_t rec[IR_LIB_RECORD_MAX];
+    bool found = false;
+    // 删除会留下空位，所以探测完全部位置
+    for (int p = 0; p < IR_LIB_PROBES && !found; p++) {
+        char k[12];
+        makeKey(hash, p, k);
+        size_t len;
+        if (readRecord(prefs, k, rec, &len) == 0) {
+            if (freeKey[0] == '\0') strcpy(freeKey, k);
+        } else if (rec[0] == nameLen && memcmp(rec + 1, name, nameLen) == 0) {
+            strcpy(key, k);
+            found = true;
+        }
+    }
+    prefs.end();
+    return found;
+}
+
+// ================= 学习 =================
+bool AppIRLibrary::startLearn(const char* name) {
+    size_t n = strlen(name);
+    if (n == 0 || n >= IR_LIB_NAME_MAX) {
+        Serial.printf("[IR LIB] 名字长度应为 1~%d 字节\n", IR_LIB_NAME_MAX - 1);
+        return false;
+    }
+    if (!MyBus.publishText(BUS_IR_LEARN, 0, 0, name)) {
+        Serial.println("[IR LIB] 红外任务忙，请稍后再试");
+        return false;
+    }
+    return true;
+}
+
+void AppIRLibrary::beginLearn(const char* name) {
+    size_t n = strnlen(name, IR_LIB_NAME_MAX);
+    if (n == 0 || n >= IR_LIB_NAME_MAX) return;
+    memcpy(_pendingName, name, n + 1);
+    _learnStartMs = millis();
+    MyIRRx.armLearn();
+    Serial.printf("[IR LIB] 学习 \"%s\": 请在 %d 秒内把遥控器对准接收头按一下\n", _pendingName, IR_LEARN_TIMEOUT_MS / 1000);
+}
+
+void AppIRLibrary::cancelLearn() {
+    MyIRRx.cancelLearn();
+    _pendingName[0] = '\0';
+}
+
+void AppIRLibrary::checkTimeout() {
+    if (_pendingName[0] == '\0' || !MyIRRx.learning()) return;
+    if (millis() - _learnStartMs > IR_LEARN_TIMEOUT_MS) {
+        Serial.printf("[IR LIB] 学习 \"%s\" 超时\n", _pendingName);
+        cancelLearn();
+    }
+}
+
+void AppIRLibrary::onEvent(const IREvent& evt) {
+    if (_pendingName[0] == '\0') return;
+    if (evt.flags & IR_EVT_LEARN_TOO_LONG) {
+        Serial.printf("[IR LIB] 信号太长 (%u 对)，超过 %d，请再按一次\n", evt.symbols, IR_LEARN_MAX_PAIRS);
+        return;
+    }
+    if (!(evt.flags & IR_EVT_LEARNED)) return;
+
+    const uint16_t* marks;
+    const uint16_t* spaces;
+    size_t n = MyIRRx.learned(&marks, &spaces);
+    uint8_t code[IR_LIB_CODE_MAX];
+    size_t len = irRawEncode(marks, spaces, n, code, sizeof(code));
+    if (len == 0) {
+        Serial.println("[IR LIB] 时长种类太多，像是干扰，请再学一次");
+        cancelLearn();
+        return;
+    }
+    if (save(_pendingName, code, len)) {
+        Serial.printf("[IR LIB] 已保存 \"%s\": %s, %u 对, %u -> %u 字节, %u 级\n", _pendingName,
+                      AppIRRx::protoName(evt.protocol), (unsigned)n, (unsigned)(n * 4), (unsigned)len, code[1]);
+    }
+    _pendingName[0] = '\0';
+}
+
+bool AppIRLibrary::save(const char* name, const uint8_t* code, size_t len) {
+    char key[12], freeKey[12];
+    if (!findKey(name, key, freeKey)) {
+        if (freeKey[0] == '\0') {
+            Serial.printf("[IR LIB] \"%s\" 的哈希位置都被占用，换个名字\n", name);
+            return false;
+        }
+        if (count() >= IR_LIB_MAX_CODES) {
+            Serial.printf("[IR LIB] 码库已满 (%d 条)，先 IR_DEL 删掉不用的\n", IR_LIB_MAX_CODES);
+            return false;
+        }
+        strcpy(key, freeKey);
+    }
+
+    uint8_t rec[IR_LIB_RECORD_MAX];
+    size_t nameLen = strlen(name);
+    rec[0] = (uint8_t)nameLen;
+    memcpy(rec + 1, name, nameLen);
+    memcpy(rec + 1 + nameLen, code, len);
+
+    Preferences prefs;
+    if (!openLib(prefs, false)) {
+        Serial.println("[IR LIB] NVS open failed (分区表里有 irlib 吗?)");
+        return false;
+    }
+    size_t written = prefs.putBytes(key, rec, 1 + nameLen + len);
+    prefs.end();
+    if (written == 0) Serial.println("[IR LIB] NVS 写入失败 (空间不足?)");
+    return written > 0;
+}
+
+// ================= 重放 / 管理 =================
+bool AppIRLibrary::send(const char* name) {
+    char key[12], freeKey[12];
+    if (!findKey(name, key, freeKey)) {
+        Serial.printf("[IR LIB] 没有学过 \"%s\"\n", name);
+        return false;
+    }
+
+    Preferences prefs;
+    uint8_t rec[IR_LIB_RECORD_MAX];
+    size_t len = 0, off = 0;
+    if (openLib(prefs, true)) {
+        off = readRecord(prefs, key, rec, &len);
+        prefs.end();
+    }
+    if (off == 0) return false;
+
+    Serial.printf("[IR LIB] 发送 \"%s\" (%u 对)\n", name, (unsigned)irRawPairs(rec + off, len - off));
+    return MyIRTx.sendRaw(rec + off, len - off);
+}
+
+bool AppIRLibrary::remove(const char* name) {
+    char key[12], freeKey[12];
+    if (!findKey(name, key, freeKey)) return false;
+    Preferences prefs;
+    if (!openLib(prefs, false)) return false;
+    bool ok = prefs.remove(key);
+    prefs.end();
+    return ok;
+}
+
+int AppIRLibrary::count() {
+    int n = 0;
+    nvs_iterator_t it = nvs_entry_find(IR_LIB_PARTITION, IR_LIB_NAMESPACE, NVS_TYPE_BLOB);
+    while (it != NULL) {
+        n++;
+        it = nvs_entry_next(it);
+    }
+    return n;
+}
+
+void AppIRLibrary::list() {
+    Preferences prefs;
+    if (!openLib(prefs, true)) {
+        Serial.println("[IR LIB] 码库为空");
+        return;
+    }
+    int count = 0;
+    size_t bytes = 0;
+    uint8_t rec[IR_LIB_RECORD_MAX];
+    nvs_iterator_t it = nvs_entry_find(IR_LIB_PARTITION, IR_LIB_NAMESPACE, NVS_TYPE_BLOB);
+    while (it != NULL) {
+        nvs_entry_info_t info;
+        nvs_entry_info(it, &info);
+        size_t len;
+        size_t off = readRecord(prefs, info.key, rec, &len);
+        if (off > 0) {
+            Serial.printf("  %-24.*s %4u 对 %4u 字节\n", rec[0], (const char*)rec + 1,
+                          (unsigned)irRawPairs(rec + off, len - off), (unsigned)len);
+            count++;
+            bytes += len;
+        }
+        it = nvs_entry_next(it);
+    }
+    nvs_release_iterator(it);
+    prefs.end();
+    Serial.printf("[IR LIB] %d/%d 条, %u 字节\n", count, IR_LIB_MAX_CODES, (unsigned)bytes);
+}
+
+bool AppIRLibrary::handleSerial(const String& cmd) {
+    if (cmd.startsWith("IR_LEARN=")) {
+        startLearn(cmd.c_str() + 9);
+    } else if (cmd.startsWith("IR_SEND=")) {
+        send(cmd.c_str() + 8);
+    } else if (cmd.startsWith("IR_DEL=")) {
+        Serial.printf("[IR LIB] 删除 \"%s\": %s\n", cmd.c_str() + 7, remove(cmd.c_str() + 7) ? "OK" : "没有这一条");
+    } else if (cmd == "IR_LIST") {
+        list();
+    } else {
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file App_IR_Library.h
+ * @brief 学习码库: 录下任意遥控器的按键，按名字存进专用 NVS 分区，按名字重放
+ * @details
+ * 学习: startLearn(name) 把名字经事件总线 (BUS_IR_LEARN) 交给 TaskIR，学习状态只在 TaskIR 里读写；
+ * TaskIR 让接收端把下一帧的原始时长留下，收到事件后用 Ir_Raw_Codec.h 量化压缩
+ * (一帧 AC 码约 90 字节，最长 345 字节)，存进 partitions.csv 里的 "irlib" 分区。
+ * 容量: 分区 128KB，最多 IR_LIB_MAX_CODES 条；按最长的码算 (每条约 13 个 32 字节的 NVS 条目)
+ * 也放得下，常见的码占不到一半。满了拒绝学新的，先 IR_DEL 删掉不用的。
+ * 键是名字的 FNV-1a 哈希 ("c" + 8 位十六进制)，冲突时最多再探测 IR_LIB_PROBES 个位置，
+ * 所以按名字查找的开销与库里有多少条无关；NVS 自己按键哈希定位条目。
+ * 重放: send(name) 读出压缩码，MyIRTx 直接解压进 RMT 缓冲。
+ * 语音 ("遥控 电视开关") 和串口 (IR_LEARN= / IR_SEND= / IR_LIST / IR_DEL=) 都走这里。
+ */
+#ifndef APP_IR_LIBRARY_H
+#define APP_IR_LIBRARY_H
+
+#include <Arduino.h>
+#include "Ir_Raw_Codec.h"
+#include "App_IR_Rx.h"
+
+#define IR_LIB_PARTITION     "irlib"     // partitions.csv 里的 NVS 分区
+#define IR_LIB_NAMESPACE     "irlib"
+#define IR_LIB_MAX_CODES     256
+#define IR_LIB_NAME_MAX      24        // 名字最多 23 字节 (UTF-8，约 7 个汉字)
+#define IR_LIB_CODE_MAX      320       // 256 对的最坏情况: 4 + 30 + 256
+#define IR_LIB_PROBES        4
+#define IR_LEARN_TIMEOUT_MS  10000
+#define IR_LEARN_POLL_MS     500       // 学习期间 TaskIR 检查超时的间隔
+
+class AppIRLibrary {
+public:
+    // 开始学习，下一次按遥控器录成 name (覆盖同名)。任意任务可调用，请求经总线交给 TaskIR
+    bool startLearn(const char* name);
+
+    // 以下只在 TaskIR 里调用
+    // TaskIR 收到 BUS_IR_LEARN 时调用
+    void beginLearn(const char* name);
+    // TaskIR 收到带学习标记的事件时调用
+    void onEvent(const IREvent& evt);
+    // TaskIR 每次醒来调用，学习超时则取消
+    void checkTimeout();
+
+    bool send(const char* name);
+    bool remove(const char* name);
+    void list();
+
+    // 串口命令: IR_LEARN=名字 / IR_SEND=名字 / IR_DEL=名字 / IR_LIST
+    bool handleSerial(const String& cmd);
+
+private:
+    // 找 name 所在的键；没找到时 freeKey 是第一个空位 (没有空位为空串)
+    bool findKey(const char* name, char* key, char* freeKey);
+    bool save(const char* name, const uint8_t* code, size_t len);
+    int count();
+    void cancelLearn();
+
+    char _pendingName[IR_LIB_NAME_MAX] = {0};   // 只在 TaskIR 里读写
+    uint32_t _learnStartMs = 0;
+};
+
+extern AppIRLibrary MyIRLib;
+
+#endif
@@ -0,0 +1,158 @@
+#include "App_IR_Rx.h"
+#include <esp_timer.h>
+#include "App_IR_Tx.h"
+
+AppIRRx MyIRRx;
+
+// 依次尝试的解码器。QD-HS 与 Coolix、Electra 与 NEC 的时序在容差内重叠，
+// 靠负载长度区分；同长度时排在前面的优先 (本机的空调是 QD-HS)
+struct IrDecoder {
+    IrProtoId id;
+    uint8_t payloadBytes;     // 0 = 不限
+    size_t (*fn)(const void* src, size_t count, uint8_t* frame, size_t maxFrame, uint8_t* payload);
+};
+
+// payload 只有 IR_STATE_SIZE 字节，帧长按本协议的反码规则折算后封顶，超长帧判为不匹配
+template <class P, class Src>
+static size_t decodeWith(const void* src, size_t count, uint8_t* frame, size_t maxFrame, uint8_t* payload) {
+    size_t cap = P::frameBytes(IR_STATE_SIZE);
+    if (cap > maxFrame) cap = maxFrame;
+    return P::decode(*(const Src*)src, count, frame, cap, payload);
+}
+
+bool AppIRRx::init(TaskHandle_t consumer) {
+    _consumer = consumer;
+
+    rmt_config_t cfg = RMT_DEFAULT_CONFIG_RX((gpio_num_t)PIN_IR_RX, IR_RX_RMT_CHANNEL);
+    cfg.clk_div = 80;                           // 1 tick = 1us，与发送端一致
+    cfg.mem_block_num = IR_RX_MEM_BLOCKS;
+    cfg.rx_config.filter_en = true;
+    cfg.rx_config.filter_ticks_thresh = IR_RX_FILTER_TICKS;
+    cfg.rx_config.idle_threshold = IR_RX_IDLE_US;
+
+    if (rmt_config(&cfg) != ESP_OK || rmt_driver_install(IR_RX_RMT_CHANNEL, IR_RX_RINGBUF_BYTES, 0) != ESP_OK) {
+        Serial.println("[IR RX] RMT init failed!");
+        return false;
+    }
+    rmt_get_ringbuf_handle(IR_RX_RMT_CHANNEL, &_rb);
+    rmt_rx_start(IR_RX_RMT_CHANNEL, true);
+
+    xTaskCreatePinnedToCore(taskEntry, "IRRx", 3072, this, 2, &_task, 0);
+    Serial.printf("[IR RX] RMT ch%d on GPIO %d, idle %dus\n", IR_RX_RMT_CHANNEL, PIN_IR_RX, IR_RX_IDLE_US);
+    return true;
+}
+
+void AppIRRx::taskEntry(void* arg) {
+    ((AppIRRx*)arg)->run();
+}
+
+void AppIRRx::run() {
+    for (;;) {
+        size_t bytes = 0;
+        rmt_item32_t* items = (rmt_item32_t*)xRingbufferReceive(_rb, &bytes, portMAX_DELAY);
+        if (items == NULL) continue;
+
+        size_t count = bytes / sizeof(rmt_item32_t);
+        _stats.frames++;
+
+        // 发送期间和刚发完收到的是自己的回波
+        if (MyIRTx.isBusy() || millis() - MyIRTx.lastTxEndMs() < IR_ECHO_GUARD_MS) {
+            _stats.echoes++;
+        } else if (count > 0) {
+            uint8_t flags = 0;
+            if (_learnArmed) {
+                if (count <= IR_LEARN_MAX_PAIRS) {
+                    for (size_t i = 0; i < count; i++) {
+                        _learnMarks[i] = items[i].duration0;
+                        _learnSpaces[i] = items[i].duration1;
+                    }
+                    _learnCount = count;
+                    _learnArmed = false;
+                    flags = IR_EVT_LEARNED;
+                } else {
+                    flags = IR_EVT_LEARN_TOO_LONG;
+                }
+            }
+            decode(items, count, flags);
+        }
+        vRingbufferReturnItem(_rb, items);
+    }
+}
+
+void AppIRRx::decode(const rmt_item32_t* items, size_t count, uint8_t flags) {
+    static const IrDecoder kDecoders[] = {
+        { IR_PROTO_QDHS,    QDHS_PAYLOAD_BYTES, decodeWith<IrQdhs, RmtSource> },
+        { IR_PROTO_COOLIX,  3,                  decodeWith<IrCoolix, RmtSource> },
+        { IR_PROTO_NEC,     4,                  decodeWith<IrNec, RmtSource> },
+        { IR_PROTO_ELECTRA, 0,                  decodeWith<IrElectra, RmtSource> },
+    };
+
+    int64_t t0 = esp_timer_get_time();
+    RmtSource src = { items };
+    uint8_t frame[IR_STATE_SIZE * 2];   // 带反码的协议帧长是负载的两倍
+
+    IREvent evt;
+    evt.protocol = IR_PROTO_UNKNOWN;
+    evt.len = 0;
+    evt.flags = flags;
+    evt.symbols = (uint16_t)count;
+    evt.timeMs = millis();
+
+    for (size_t i = 0; i < sizeof(kDecoders) / sizeof(kDecoders[0]); i++) {
+        const IrDecoder& d = kDecoders[i];
+        size_t n = d.fn(&src, count, frame, sizeof(frame), evt.data);
+        if (n > 0 && (d.payloadBytes == 0 || n == d.payloadBytes)) {
+            evt.protocol = d.id;
+            evt.len = (uint8_t)n;
+            break;
+        }
+    }
+    _stats.lastDecodeUs = (uint32_t)(esp_timer_get_time() - t0);
+    if (evt.protocol == IR_PROTO_UNKNOWN) _stats.unknown++;
+    else _stats.decoded++;
+
+    if (!MyBus.publishPayload(BUS_IR, evt.protocol, evt)) _stats.dropped++;
+
+    if (_diag) dump(items, count, evt);
+}
+
+// 诊断输出: 逐项时长，可直接抄进 raw 发送数组。每秒最多一帧，其余只计数
+void AppIRRx::dump(const rmt_item32_t* items, size_t count, const IREvent& evt) {
+    uint32_t now = millis();
+    if (now - _lastDiagMs < IR_DIAG_INTERVAL_MS) {
+        _stats.diagSkipped++;
+        return;
+    }
+    _lastDiagMs = now;
+
+    Serial.printf("[IR DIAG] %s, %u symbols, decode %uus, skipped %u\n", protoName(evt.protocol),
+                  (unsigned)count, (unsigned)_stats.lastDecodeUs, (unsigned)_stats.diagSkipped);
+    for (size_t i = 0; i < count; i++) {
+        Serial.printf("%u,%u%s", items[i].duration0, items[i].duration1, (i % 8 == 7 || i == count - 1) ? ",\n" : ", ");
+    }
+}
+
+void AppIRRx::armLearn() {
+    _learnArmed = true;
+    if (_consumer) xTaskNotifyGive(_consumer);
+}
+
+size_t AppIRRx::learned(const uint16_t** marks, const uint16_t** spaces) {
+    *marks = _learnMarks;
+    *spaces = _learnSpaces;
+    return _learnCount;
+}
+
+void AppIRRx::getStats(IrRxStats* out) {
+    if (out) *out = _stats;
+}
+
+const char* AppIRRx::protoName(IrProtoId id) {
+    switch (id) {
+        case IR_PROTO_NEC:     return "NEC";
+        case IR_PROTO_COOLIX:  return "COOLIX";
+        case IR_PROTO_ELECTRA: return "ELECTRA";
+        case IR_PROTO_QDHS:    return "QD-HS6324";
+        default:               return "UNKNOWN";
+    }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file App_IR_Rx.h
+ * @brief 红外接收: RMT 接收通道 + 解码任务，解出的 IREvent 发到事件总线 (BUS_IR)
+ * @details
+ * RMT 硬件按边沿记录时长，一帧结束 (空闲超过 IR_RX_IDLE_US) 后由驱动放进 ringbuffer，
+ * 接收任务阻塞等待，不再每 50ms 轮询。解码按 Ir_Protocol.h 的协议描述逐个尝试，
+ * 全程不分配堆内存，结果是定长的 IREvent。
+ * 逐项时长打印只在诊断模式下进行，并限制频率，不会拖住接收。
+ * 消费者 (TaskIR) 订阅 BUS_IR，由总线通知；init 时登记的任务句柄只用于学习开始时唤醒它。
+ * 学习模式下下一帧的原始时长另存一份，事件带 IR_EVT_LEARNED，由消费者压缩入库。
+ */
+#ifndef APP_IR_RX_H
+#define APP_IR_RX_H
+
+#include <Arduino.h>
+#include <driver/rmt.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "Pin_Config.h"
+#include "Ir_Protocol.h"
+#include "App_Bus.h"
+
+#define IR_RX_RMT_CHANNEL    RMT_CHANNEL_4     // S3 的 4~7 号通道才能接收
+#define IR_RX_MEM_BLOCKS     4                 // 4 x 48 item，够一帧 Electra (106 个符号)
+#define IR_RX_RINGBUF_BYTES  2048
+#define IR_RX_IDLE_US        12000             // 比所有协议的 bit/引导 space 都长，比 RMT 上限 32767 短
+#define IR_RX_FILTER_TICKS   200               // APB 时钟周期，滤掉 2.5us 以下的毛刺
+#define IR_DIAG_INTERVAL_MS  1000              // 诊断打印的最小间隔
+#define IR_LEARN_MAX_PAIRS   256               // 学习一帧最多的 (mark, space) 对数
+
+// 发送结束后多久内收到的信号视为自己的回波 (ms)
+#define IR_ECHO_GUARD_MS 50
+
+// 最大负载长度 (字节)，Electra 13 字节，留余量
+#define IR_STATE_SIZE 32
+
+enum IrProtoId : uint8_t {
+    IR_PROTO_UNKNOWN = 0,
+    IR_PROTO_NEC,
+    IR_PROTO_COOLIX,
+    IR_PROTO_ELECTRA,
+    IR_PROTO_QDHS
+};
+
+enum IrEventFlags : uint8_t {
+    IR_EVT_LEARNED        = 0x01,  // 原始时长已存入学习缓冲
+    IR_EVT_LEARN_TOO_LONG = 0x02   // 处于学习模式，但帧超过 IR_LEARN_MAX_PAIRS
+};
+
+// 解码结果，定长、可平凡拷贝
+struct IREvent {
+    IrProtoId protocol;
+    uint8_t len;                   // data 的有效字节数，UNKNOWN 时为 0
+    uint8_t flags;                 // IrEventFlags
+    uint16_t symbols;              // (mark, space) 对数
+    uint32_t timeMs;               // 收到的时间 (millis)
+    uint8_t data[IR_STATE_SIZE];   // 负载 (已去掉反码)
+};
+
+struct IrRxStats {
+    uint32_t frames;       // 收到的帧 (含回波)
+    uint32_t decoded;      // 成功解码
+    uint32_t unknown;      // 没有协议能解
+    uint32_t echoes;       // 自己发出的回波
+    uint32_t dropped;      // 总线上没投递出去
+    uint32_t diagSkipped;  // 诊断模式下因限频没打印的帧
+    uint32_t lastDecodeUs;
+};
+
+class AppIRRx {
+public:
+    // 安装 RMT 接收、创建接收任务。consumer 是处理学习的任务 (TaskIR)
+    bool init(TaskHandle_t consumer);
+
+    // 诊断模式: 打印每帧的原始时长 (限频)
+    void setDiag(bool on) { _diag = on; }
+    bool diag() const { return _diag; }
+
+    // 学习: 下一帧 (回波除外) 的原始时长存进学习缓冲；顺便唤醒消费者开始计超时
+    void armLearn();
+    void cancelLearn() { _learnArmed = false; }
+    bool learning() const { return _learnArmed; }
+    // 收到 IR_EVT_LEARNED 后由消费者读取，下次 armLearn 之前不会被覆盖
+    size_t learned(const uint16_t** marks, const uint16_t** spaces);
+
+    void getStats(IrRxStats* out);
+
+    static const char* protoName(IrProtoId id);
+
+private:
+    // RMT item -> 协议解码器的 (mark, space) 源；接收头输出低电平表示有载波
+    struct RmtSource {
+        const rmt_item32_t* items;
+        uint16_t mark(size_t i) const { return items[i].duration0; }
+        uint16_t space(size_t i) const { return items[i].duration1; }
+    };
+
+    static void taskEntry(void* arg);
+    void run();
+    void decode(const rmt_item32_t* items, size_t count, uint8_t flags);
+    void dump(const rmt_item32_t* items, size_t count, const IREvent& evt);
+
+    RingbufHandle_t _rb = NULL;
+    TaskHandle_t _task = NULL;
+    TaskHandle_t _consumer = NULL;
+    volatile bool _diag = false;
+    uint32_t _lastDiagMs = 0;
+    volatile bool _learnArmed = false;
+    uint16_t _learnMarks[IR_LEARN_MAX_PAIRS];
+    uint16_t _learnSpaces[IR_LEARN_MAX_PAIRS];
+    size_t _learnCount = 0;
+    IrRxStats _stats = {0, 0, 0, 0, 0, 0, 0};
+};
+
+extern AppIRRx MyIRRx;
+
+#endif
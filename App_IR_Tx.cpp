@@ -0,0 +1,125 @@
+#include "App_IR_Tx.h"
+#include <esp_timer.h>
+
+AppIRTx MyIRTx;
+
+bool AppIRTx::init() {
+    rmt_config_t cfg = RMT_DEFAULT_CONFIG_TX((gpio_num_t)PIN_IR_TX, IR_TX_RMT_CHANNEL);
+    cfg.clk_div = 80;                         // 1 tick = 1us
+    cfg.mem_block_num = IR_TX_MEM_BLOCKS;
+    cfg.tx_config.carrier_en = true;
+    cfg.tx_config.carrier_freq_hz = IR_TX_CARRIER_HZ;
+    cfg.tx_config.carrier_duty_percent = IR_TX_DUTY_PCT;
+    cfg.tx_config.carrier_level = RMT_CARRIER_LEVEL_HIGH;
+    cfg.tx_config.idle_output_en = true;
+    cfg.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+
+    if (rmt_config(&cfg) != ESP_OK || rmt_driver_install(IR_TX_RMT_CHANNEL, 0, 0) != ESP_OK) {
+        Serial.println("[IR TX] RMT init failed!");
+        return false;
+    }
+
+    _freeQ = xQueueCreate(IR_TX_POOL_SIZE, sizeof(uint8_t));
+    _sendQ = xQueueCreate(IR_TX_POOL_SIZE, sizeof(TxJob));
+    for (uint8_t i = 0; i < IR_TX_POOL_SIZE; i++) xQueueSend(_freeQ, &i, 0);
+
+    xTaskCreatePinnedToCore(taskEntry, "IRTx", 3072, this, 2, &_task, 0);
+    Serial.printf("[IR TX] RMT ch%d on GPIO %d, %d x %d items\n",
+                  IR_TX_RMT_CHANNEL, PIN_IR_TX, IR_TX_POOL_SIZE, IR_TX_MAX_ITEMS);
+    return true;
+}
+
+bool AppIRTx::reject() {
+    _stats.dropped++;
+    return false;
+}
+
+int AppIRTx::acquire() {
+    uint8_t slot;
+    if (_freeQ == NULL) {
+        reject();
+        return -1;
+    }
+    if (xQueueReceive(_freeQ, &slot, 0) != pdTRUE) {
+        reject();
+        Serial.println("[IR TX] Busy, frame dropped.");
+        return -1;
+    }
+    return slot;
+}
+
+void AppIRTx::release(int slot) {
+    uint8_t s = (uint8_t)slot;
+    xQueueSend(_freeQ, &s, 0);
+}
+
+bool AppIRTx::submit(int slot, size_t count, uint8_t repeat, uint32_t gapUs) {
+    TxJob job = { (uint8_t)slot, repeat, (uint16_t)count, gapUs };
+    xQueueSend(_sendQ, &job, 0);            // 队列深度 = 缓冲数，不会满
+    _stats.queued++;
+    if (count > _stats.maxItems) _stats.maxItems = count;
+    return true;
+}
+
+bool AppIRTx::sendNEC(uint32_t data) {
+    uint8_t bytes[4] = { (uint8_t)(data >> 24), (uint8_t)(data >> 16), (uint8_t)(data >> 8), (uint8_t)data };
+    return send<IrNec>(bytes, sizeof(bytes));
+}
+
+bool AppIRTx::sendCoolix(uint32_t data) {
+    uint8_t bytes[3] = { (uint8_t)(data >> 16), (uint8_t)(data >> 8), (uint8_t)data };
+    return send<IrCoolix>(bytes, sizeof(bytes));
+}
+
+bool AppIRTx::sendRaw(const uint8_t* code, size_t len) {
+    if (irRawPairs(code, len) > IR_TX_MAX_ITEMS) return reject();
+    int slot = acquire();
+    if (slot < 0) return false;
+    RmtSink sink = { _pool[slot], 0 };
+    size_t count = irRawDecode(code, len, sink, IR_TX_MAX_ITEMS);
+    if (count == 0) {
+        release(slot);
+        return reject();
+    }
+    // 学习时已经把整段 (含重复帧和帧间隔) 录下来，发一遍即可
+    return submit(slot, count, 1, IR_TX_RAW_GAP_US);
+}
+
+bool AppIRTx::isBusy() {
+    return _sending || (_sendQ && uxQueueMessagesWaiting(_sendQ) > 0);
+}
+
+void AppIRTx::getStats(IrTxStats* out) {
+    if (out) *out = _stats;
+}
+
+void AppIRTx::taskEntry(void* arg) {
+    ((AppIRTx*)arg)->run();
+}
+
+void AppIRTx::run() {
+    TxJob job;
+    for (;;) {
+        if (xQueueReceive(_sendQ, &job, portMAX_DELAY) != pdTRUE) continue;
+        _sending = true;
+
+        for (uint8_t r = 0; r < job.repeat; r++) {
+            // 等上一帧的帧间隔结束
+            int64_t wait = _readyAtUs - esp_timer_get_time();
+            if (wait > 2000) vTaskDelay(pdMS_TO_TICKS((wait + 999) / 1000));
+            else if (wait > 0) delayMicroseconds((uint32_t)wait);
+
+            int64_t t0 = esp_timer_get_time();
+            rmt_write_items(IR_TX_RMT_CHANNEL, _pool[job.slot], job.count, true);
+            int64_t t1 = esp_timer_get_time();
+
+            _readyAtUs = t1 + job.gapUs;
+            _stats.lastFrameUs = (uint32_t)(t1 - t0);
+            _stats.sent++;
+        }
+
+        xQueueSend(_freeQ, &job.slot, 0);
+        _lastTxEndMs = millis();
+        _sending = false;
+    }
+}
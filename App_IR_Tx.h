@@ -0,0 +1,110 @@
+/**
+ * @file App_IR_Tx.h
+ * @brief 红外发送引擎: 独占一个 RMT 通道，异步排队发送
+ * @details
+ * 调用方在自己的任务里按 Ir_Protocol.h 的协议描述把帧编码成 RMT item，写进预先分配的缓冲池，
+ * 然后交给发送任务排队；调用方不用等 100ms 级的帧时长，也不再每次临时 new IRsend。
+ * 发送任务用 rmt_write_items 等发送结束、按协议要求留出帧间隔，再归还缓冲。
+ * 任何任务都可以调用 send 系列接口。
+ */
+#ifndef APP_IR_TX_H
+#define APP_IR_TX_H
+
+#include <Arduino.h>
+#include <driver/rmt.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include "Pin_Config.h"
+#include "Ir_Protocol.h"
+#include "Ir_Raw_Codec.h"
+
+#define IR_TX_RMT_CHANNEL   RMT_CHANNEL_0
+#define IR_TX_MEM_BLOCKS    2        // S3 每块 48 个 item，更长的帧由驱动在中断里分段填充
+#define IR_TX_POOL_SIZE     4        // 同时排队的帧数
+#define IR_TX_MAX_ITEMS     256      // 每帧最多 item 数 (一个 bit 一个 item)
+#define IR_TX_CARRIER_HZ    38000
+#define IR_TX_DUTY_PCT      33
+#define IR_TX_RAW_GAP_US    20000    // 学习码之后的静默，接收端靠空闲分帧
+
+struct IrTxStats {
+    uint32_t queued;         // 成功排队的帧
+    uint32_t sent;           // 实际发出的帧 (含重复)
+    uint32_t dropped;        // 缓冲用完或参数错误被丢弃
+    uint32_t lastFrameUs;    // 最近一帧的发送耗时
+    uint16_t maxItems;       // 用到的最大 item 数
+};
+
+class AppIRTx {
+public:
+    // 安装 RMT 驱动、创建发送任务
+    bool init();
+
+    // 按协议 P 编码 n 字节负载 (反码由协议规则自动插入)，排队发送 P::kRepeats 次。
+    // 不阻塞，缓冲用完时返回 false
+    template <class P>
+    bool send(const uint8_t* payload, size_t n) {
+        uint8_t frame[IR_TX_MAX_ITEMS / 8];
+        if (P::symbolCount(n) > IR_TX_MAX_ITEMS) return reject();
+        int slot = acquire();
+        if (slot < 0) return false;
+        RmtSink sink = { _pool[slot], 0 };
+        size_t count = P::encode(payload, n, frame, sink);
+        return submit(slot, count, P::kRepeats, P::kGapUs);
+    }
+
+    // NEC 32 位 (MSB 在前，与 IRremoteESP8266 的 sendNEC 一致)
+    bool sendNEC(uint32_t data);
+    // Coolix 24 位，每个字节后跟反码，整帧发两遍
+    bool sendCoolix(uint32_t data);
+    // 学习到的原始码 (Ir_Raw_Codec.h 格式)，直接解压进 RMT 缓冲
+    bool sendRaw(const uint8_t* code, size_t len);
+
+    // 正在发送或还有排队的帧
+    bool isBusy();
+    // 最近一帧发完的时间 (millis)，接收端用来过滤自己发出的回波
+    uint32_t lastTxEndMs() { return _lastTxEndMs; }
+
+    void getStats(IrTxStats* out);
+
+private:
+    // 把 (mark, space) 写成 RMT item，space = 0 即帧结束
+    struct RmtSink {
+        rmt_item32_t* items;
+        size_t n;
+        void operator()(uint16_t mark, uint16_t space) {
+            rmt_item32_t& it = items[n++];
+            it.level0 = 1;
+            it.duration0 = mark;
+            it.level1 = 0;
+            it.duration1 = space;
+        }
+    };
+
+    struct TxJob {
+        uint8_t slot;
+        uint8_t repeat;
+        uint16_t count;
+        uint32_t gapUs;
+    };
+
+    int acquire();
+    void release(int slot);
+    bool submit(int slot, size_t count, uint8_t repeat, uint32_t gapUs);
+    bool reject();
+    static void taskEntry(void* arg);
+    void run();
+
+    rmt_item32_t _pool[IR_TX_POOL_SIZE][IR_TX_MAX_ITEMS];
+    QueueHandle_t _freeQ = NULL;     // 空闲缓冲的编号
+    QueueHandle_t _sendQ = NULL;     // 待发送的 TxJob
+    TaskHandle_t _task = NULL;
+    volatile bool _sending = false;
+    volatile uint32_t _lastTxEndMs = 0;
+    int64_t _readyAtUs = 0;          // 上一帧的帧间隔结束时间
+    IrTxStats _stats = {0, 0, 0, 0, 0};
+};
+
+extern AppIRTx MyIRTx;
+
+#endif
@@ -0,0 +1,142 @@
+#include "App_QR_Cache.h"
+#include "App_Display.h"
+#include <esp_heap_caps.h>
+#include <src/extra/libs/qrcode/qrcodegen.h>
+
+AppQRCache MyQRCache;
+
+// 优先放 PSRAM，没有 PSRAM 时退回内部 RAM
+static void* qr_malloc(size_t size) {
+    void* p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (p == NULL) p = malloc(size);
+    return p;
+}
+
+void AppQRCache::init() {
+    for (int i = 0; i < QR_SLOT_COUNT; i++) {
+        _slots[i].payload[0] = '\0';
+        _slots[i].encoded[0] = '\0';
+        _slots[i].dirty = false;
+        _slots[i].ready.store(NULL);
+        _slots[i].shown = NULL;
+    }
+    _qrBuf  = (uint8_t*)qr_malloc(qrcodegen_BUFFER_LEN_MAX);
+    _tmpBuf = (uint8_t*)qr_malloc(qrcodegen_BUFFER_LEN_MAX);
+    if (_qrBuf == NULL || _tmpBuf == NULL) {
+        Serial.println("[QR] Error: buffer alloc failed");
+        return;
+    }
+    xTaskCreatePinnedToCore(taskEntry, "QR", 4096, this, 1, &_task, 0);
+}
+
+void AppQRCache::request(QRSlot slot, const char* payload) {
+    if (slot >= QR_SLOT_COUNT || payload == NULL) return;
+
+    portENTER_CRITICAL(&_mux);
+    strlcpy(_slots[slot].payload, payload, QR_PAYLOAD_MAX);
+    _slots[slot].dirty = true;
+    portEXIT_CRITICAL(&_mux);
+
+    if (_task) xTaskNotifyGive(_task);
+}
+
+const lv_img_dsc_t* AppQRCache::acquire(QRSlot slot) {
+    if (slot >= QR_SLOT_COUNT) return NULL;
+    Slot& s = _slots[slot];
+
+    lv_img_dsc_t* fresh = s.ready.exchange(NULL);
+    if (fresh) {
+        // 旧图可能还在 LVGL 图片缓存里，释放前先作废
+        if (s.shown) {
+            lv_img_cache_invalidate_src(s.shown);
+            free(s.shown);
+        }
+        s.shown = fresh;
+    }
+    return s.shown;
+}
+
+void AppQRCache::taskEntry(void* arg) {
+    static_cast<AppQRCache*>(arg)->taskLoop();
+}
+
+void AppQRCache::taskLoop() {
+    char payload[QR_PAYLOAD_MAX];
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        for (int i = 0; i < QR_SLOT_COUNT; i++) {
+            Slot& s = _slots[i];
+
+            portENTER_CRITICAL(&_mux);
+            bool dirty = s.dirty;
+            s.dirty = false;
+            if (dirty) memcpy(payload, s.payload, QR_PAYLOAD_MAX);
+            portEXIT_CRITICAL(&_mux);
+
+            if (!dirty || strcmp(payload, s.encoded) == 0) continue;
+
+            uint32_t t0 = micros();
+            lv_img_dsc_t* dsc = render(payload);
+            if (dsc == NULL) continue;
+            strlcpy(s.encoded, payload, QR_PAYLOAD_MAX);
+            Serial.printf("[QR] Slot %d ready: %dx%d, %u us\n", i, dsc->header.w, dsc->header.h, micros() - t0);
+
+            // UI 还没取走上一张就直接丢掉上一张
+            lv_img_dsc_t* stale = s.ready.exchange(dsc);
+            if (stale) free(stale);
+            MyDisplay.wake();
+        }
+    }
+}
+
+// 编码并画成 LV_IMG_CF_INDEXED_1BIT: 2 色调色板 + 每行按字节对齐，高位在左
+lv_img_dsc_t* AppQRCache::render(const char* payload) {
+    if (!qrcodegen_encodeText(payload, _tmpBuf, _qrBuf, qrcodegen_Ecc_MEDIUM,
+                              qrcodegen_VERSION_MIN, qrcodegen_VERSION_MAX, qrcodegen_Mask_AUTO, true)) {
+        Serial.printf("[QR] Error: payload too long (%u bytes)\n", strlen(payload));
+        return NULL;
+    }
+
+    int modules = qrcodegen_getSize(_qrBuf);
+    int total = modules + QR_QUIET_ZONE * 2;
+    int scale = QR_TARGET_PX / total;
+    if (scale < 1) scale = 1;
+    int side = total * scale;
+    int stride = (side + 7) / 8;
+
+    size_t paletteSize = 2 * sizeof(lv_color32_t);
+    size_t dataSize = paletteSize + (size_t)stride * side;
+    lv_img_dsc_t* dsc = (lv_img_dsc_t*)qr_malloc(sizeof(lv_img_dsc_t) + dataSize);
+    if (dsc == NULL) {
+        Serial.println("[QR] Error: image alloc failed");
+        return NULL;
+    }
+
+    uint8_t* data = (uint8_t*)(dsc + 1);
+    lv_color32_t* palette = (lv_color32_t*)data;
+    palette[0].full = 0xFFFFFFFF;   // 0 = 白
+    palette[1].full = 0xFF000000;   // 1 = 黑
+    uint8_t* pixels = data + paletteSize;
+    memset(pixels, 0, (size_t)stride * side);
+
+    for (int y = 0; y < side; y++) {
+        int my = y / scale - QR_QUIET_ZONE;
+        uint8_t* row = pixels + (size_t)y * stride;
+        for (int x = 0; x < side; x++) {
+            int mx = x / scale - QR_QUIET_ZONE;
+            if (qrcodegen_getModule(_qrBuf, mx, my)) {   // 越界返回 false (静区)
+                row[x >> 3] |= (uint8_t)(0x80 >> (x & 7));
+            }
+        }
+    }
+
+    memset(&dsc->header, 0, sizeof(dsc->header));
+    dsc->header.always_zero = 0;
+    dsc->header.cf = LV_IMG_CF_INDEXED_1BIT;
+    dsc->header.w = side;
+    dsc->header.h = side;
+    dsc->data_size = dataSize;
+    dsc->data = data;
+    return dsc;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file App_QR_Cache.h
+ * @brief 二维码后台生成与缓存
+ * @details
+ * 后台任务用 LVGL 自带的 qrcodegen 编码，直接画成 1-bit 索引图 (放 PSRAM)，
+ * UI 任务拿到的是现成的 lv_img_dsc_t，切屏时只需 lv_img_set_src。
+ * 同一个槽位的内容不变就不会重新编码。
+ */
+#ifndef APP_QR_CACHE_H
+#define APP_QR_CACHE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+enum QRSlot : uint8_t {
+    QR_SLOT_IMEI = 0,     // 设备 IMEI (模组开机读到之后才有)
+    QR_SLOT_COUNT
+};
+
+#define QR_PAYLOAD_MAX   128
+#define QR_TARGET_PX     110   // 目标边长 (含静区)，按整数倍放大
+#define QR_QUIET_ZONE    2     // 静区宽度 (模块数)
+
+class AppQRCache {
+public:
+    // 创建后台编码任务
+    void init();
+
+    // 任何任务可调用：提交槽位内容，内容变化时后台重新编码
+    void request(QRSlot slot, const char* payload);
+
+    // UI 任务调用：返回该槽位最新的图片，还没生成好返回 NULL
+    // 返回的指针在下一次 acquire 同一槽位之前一直有效
+    const lv_img_dsc_t* acquire(QRSlot slot);
+    // 有新生成的图片等着 acquire 取走
+    bool hasUpdate(QRSlot slot) { return slot < QR_SLOT_COUNT && _slots[slot].ready.load() != NULL; }
+
+private:
+    static void taskEntry(void* arg);
+    void taskLoop();
+    lv_img_dsc_t* render(const char* payload);
+
+    struct Slot {
+        char payload[QR_PAYLOAD_MAX];   // 最新请求的内容
+        char encoded[QR_PAYLOAD_MAX];   // 已编码的内容 (后台任务私有)
+        bool dirty;
+        std::atomic<lv_img_dsc_t*> ready;   // 后台生成、等待 UI 取走
+        lv_img_dsc_t* shown;                // UI 正在使用 (只在 UI 任务里访问)
+    };
+
+    Slot _slots[QR_SLOT_COUNT];
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+    TaskHandle_t _task = NULL;
+    uint8_t* _qrBuf = NULL;
+    uint8_t* _tmpBuf = NULL;
+};
+
+extern AppQRCache MyQRCache;
+
+#endif
@@ -0,0 +1,312 @@
+#include "App_Reply_View.h"
+#include <string.h>
+
+// 主机上的 UI 基准 (tools/ui_bench) 也会编译本文件
+#ifdef ARDUINO
+#include <esp_timer.h>
+#else
+#include <time.h>
+#endif
+
+// tools/reply_font 生成的中文子集字体；没有生成时链接结果为 NULL
+extern "C" {
+extern const lv_font_t ui_font_Reply __attribute__((weak));
+}
+
+AppReplyView MyReplyView;
+lv_obj_t* ui_ReplyScreen = NULL;
+
+static const uint32_t NO_POS = 0xFFFFFFFF;
+
+static int64_t reply_now_us() {
+#ifdef ARDUINO
+    return esp_timer_get_time();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+// 英文/数字连成的词不在中间断开
+static bool isWordChar(uint32_t c) {
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '\'' || c == '-';
+}
+
+// 不能出现在行首的标点 (避头)
+static bool isClosingPunct(uint32_t c) {
+    switch (c) {
+        case ',': case '.': case '!': case '?': case ';': case ':': case ')':
+        case 0x3001: case 0x3002:                   // 、。
+        case 0xFF0C: case 0xFF01: case 0xFF1F:      // ，！？
+        case 0xFF1B: case 0xFF1A: case 0xFF09:      // ；：）
+        case 0x201D: case 0x2019: case 0x300D:      // ” ’ 」
+            return true;
+        default:
+            return false;
+    }
+}
+
+// ================= 屏幕 =================
+void ui_ReplyScreen_screen_init(void) {
+    ui_ReplyScreen = lv_obj_create(NULL);
+    lv_obj_clear_flag(ui_ReplyScreen, LV_OBJ_FLAG_SCROLLABLE);
+    MyReplyView.create(ui_ReplyScreen);
+}
+
+void ui_ReplyScreen_screen_destroy(void) {
+    if (ui_ReplyScreen) lv_obj_del(ui_ReplyScreen);
+    ui_ReplyScreen = NULL;
+}
+
+// ================= 文本区 =================
+bool AppReplyView::hasFont() {
+    return &ui_font_Reply != NULL;
+}
+
+// 子集字体在时都交给它 (词表外的字显示为空)；只有默认字体时要求每个字都有字形
+bool AppReplyView::canDraw(const char* utf8) {
+    if (hasFont()) return true;
+    uint32_t i = 0;
+    while (utf8[i] != '\0') {
+        uint32_t letter = _lv_txt_encoded_next(utf8, &i);
+        if (letter == '\r' || letter == '\n') continue;
+        lv_font_glyph_dsc_t g;
+        if (!lv_font_get_glyph_dsc(LV_FONT_DEFAULT, &g, letter, 0)) return false;
+    }
+    return true;
+}
+
+void AppReplyView::create(lv_obj_t* parent) {
+    _font = hasFont() ? &ui_font_Reply : LV_FONT_DEFAULT;
+    _lineHeight = lv_font_get_line_height(_font) + REPLY_LINE_SPACE;
+    memset(_glyphs, 0, sizeof(_glyphs));
+
+    _obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(_obj);
+    lv_obj_set_size(_obj, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_pad_all(_obj, REPLY_PAD, LV_PART_MAIN);
+    lv_obj_clear_flag(_obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(_obj, drawEvent, LV_EVENT_DRAW_MAIN, this);
+    lv_obj_add_event_cb(_obj, deleteEvent, LV_EVENT_DELETE, this);
+
+    _timer = lv_timer_create(timerCb, REPLY_SCROLL_PERIOD_MS, this);
+    lv_timer_pause(_timer);
+
+    // 屏幕被释放后重建: 保留原来的文字，从头显示
+    lv_obj_update_layout(_obj);
+    setText(_text);
+}
+
+void AppReplyView::deleteEvent(lv_event_t* e) {
+    AppReplyView* self = (AppReplyView*)lv_event_get_user_data(e);
+    if (self->_timer) lv_timer_del(self->_timer);
+    self->_timer = NULL;
+    self->_obj = NULL;
+}
+
+void AppReplyView::setText(const char* utf8) {
+    if (utf8 != _text) {
+        // '\r' 拷贝时就去掉，断行只认 '\n'
+        size_t n = 0;
+        const char* p = utf8;
+        for (; *p != '\0' && n < sizeof(_text) - 1; p++) {
+            if (*p != '\r') _text[n++] = *p;
+        }
+        // 截断在字符中间时去掉不完整的字符
+        if (((uint8_t)*p & 0xC0) == 0x80) {
+            while (n > 0 && ((uint8_t)_text[n - 1] & 0xC0) == 0x80) n--;
+            if (n > 0) n--;
+        }
+        _text[n] = '\0';
+    }
+    if (_obj == NULL) return;   // 屏幕还没建，create 时再排版
+
+    layout();
+    _scrollY = 0;
+    _shownTick = lv_tick_get();
+    _doneTick = 0;
+    if (_maxScroll > 0) lv_timer_resume(_timer);
+    else lv_timer_pause(_timer);
+    lv_obj_invalidate(_obj);
+}
+
+uint16_t AppReplyView::glyphWidth(uint32_t letter) {
+    GlyphSlot& slot = _glyphs[letter & (REPLY_GLYPH_CACHE - 1)];
+    if (slot.letter == letter) {
+        _stats.glyphHits++;
+        return slot.width;
+    }
+    _stats.glyphMisses++;
+    slot.letter = letter;
+    slot.width = lv_font_get_glyph_width(_font, letter, 0);
+    return slot.width;
+}
+
+bool AppReplyView::pushLine(uint32_t start, uint32_t end) {
+    if (_lineCount >= REPLY_MAX_LINES) return false;
+    _lines[_lineCount].start = (uint16_t)start;
+    _lines[_lineCount].len = (uint16_t)(end - start);
+    _lineCount++;
+    return true;
+}
+
+// 按内容宽度断行: 中文任意处可断，英文单词整体换行，句末标点不放行首
+void AppReplyView::layout() {
+    int64_t t0 = reply_now_us();
+    int32_t maxW = lv_obj_get_content_width(_obj);
+    _lineCount = 0;
+
+    uint32_t lineStart = 0, lineW = 0;
+    uint32_t wordStart = NO_POS, wordW = 0;   // 当前英文单词
+    uint32_t prevPos = NO_POS, prevW = 0;     // 上一个字符
+    uint32_t i = 0;
+    bool full = false;
+
+    while (_text[i] != '\0' && !full) {
+        uint32_t pos = i;
+        uint32_t letter = _lv_txt_encoded_next(_text, &i);
+
+        if (letter == '\n') {
+            full = !pushLine(lineStart, pos);
+            lineStart = i;
+            lineW = 0;
+            wordStart = prevPos = NO_POS;
+            continue;
+        }
+
+        uint16_t w = glyphWidth(letter);
+        bool overflow = (int32_t)(lineW + w) > maxW || i - lineStart > REPLY_LINE_BYTES - 1;
+        if (overflow && pos > lineStart) {
+            if (isWordChar(letter) && wordStart != NO_POS && wordStart > lineStart) {
+                // 整个单词挪到下一行
+                full = !pushLine(lineStart, wordStart);
+                lineStart = wordStart;
+                lineW = wordW;
+            } else if (isClosingPunct(letter) && prevPos != NO_POS && prevPos > lineStart) {
+                // 标点连同前一个字一起换行
+                full = !pushLine(lineStart, prevPos);
+                lineStart = prevPos;
+                lineW = prevW;
+            } else {
+                full = !pushLine(lineStart, pos);
+                lineStart = pos;
+                lineW = 0;
+                if (letter == ' ') {   // 行首空格丢掉
+                    lineStart = i;
+                    wordStart = prevPos = NO_POS;
+                    continue;
+                }
+            }
+        }
+
+        lineW += w;
+        if (isWordChar(letter)) {
+            if (wordStart == NO_POS) {
+                wordStart = pos;
+                wordW = 0;
+            }
+            wordW += w;
+        } else {
+            wordStart = NO_POS;
+        }
+        prevPos = pos;
+        prevW = w;
+    }
+    if (!full && i > lineStart) pushLine(lineStart, i);
+
+    int32_t viewH = lv_obj_get_content_height(_obj);
+    _maxScroll = _lineCount * _lineHeight - REPLY_LINE_SPACE - viewH;
+    if (_maxScroll < 0) _maxScroll = 0;
+
+    _stats.lines = _lineCount;
+    _stats.layoutUs = (uint32_t)(reply_now_us() - t0);
+}
+
+void AppReplyView::drawEvent(lv_event_t* e) {
+    AppReplyView* self = (AppReplyView*)lv_event_get_user_data(e);
+    self->draw(lv_event_get_draw_ctx(e));
+}
+
+// 只画与本次裁剪区 (刷屏分块) 相交的行
+void AppReplyView::draw(lv_draw_ctx_t* ctx) {
+    if (_lineCount == 0) return;
+
+    lv_area_t content;
+    lv_obj_get_content_coords(_obj, &content);
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, ctx->clip_area, &content)) return;
+
+    int64_t t0 = reply_now_us();
+    const lv_area_t* oldClip = ctx->clip_area;
+    ctx->clip_area = &clip;
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(_obj, LV_PART_MAIN, &dsc);
+    dsc.font = _font;
+    dsc.flag = LV_TEXT_FLAG_EXPAND;   // 已经断好行，不让 LVGL 再折行
+
+    int32_t first = (clip.y1 - content.y1 + _scrollY) / _lineHeight;
+    int32_t last = (clip.y2 - content.y1 + _scrollY) / _lineHeight;
+    if (first < 0) first = 0;
+    if (last >= _lineCount) last = _lineCount - 1;
+
+    char buf[REPLY_LINE_BYTES];
+    for (int32_t l = first; l <= last; l++) {
+        const Line& line = _lines[l];
+        uint16_t len = line.len < sizeof(buf) ? line.len : sizeof(buf) - 1;
+        memcpy(buf, _text + line.start, len);
+        buf[len] = '\0';
+
+        lv_area_t area;
+        area.x1 = content.x1;
+        area.x2 = content.x2;
+        area.y1 = content.y1 + l * _lineHeight - _scrollY;
+        area.y2 = area.y1 + _lineHeight - 1;
+        lv_draw_label(ctx, &dsc, &area, buf, NULL);
+        _stats.linesDrawn++;
+    }
+
+    ctx->clip_area = oldClip;
+    _stats.drawUs += (uint32_t)(reply_now_us() - t0);
+}
+
+void AppReplyView::timerCb(lv_timer_t* t) {
+    ((AppReplyView*)t->user_data)->scroll();
+}
+
+// 按时间算位置，掉帧时滚动速度不变
+void AppReplyView::scroll() {
+    uint32_t elapsed = lv_tick_elaps(_shownTick);
+    if (elapsed < REPLY_SCROLL_DELAY_MS) return;
+
+    int32_t y = (int32_t)((elapsed - REPLY_SCROLL_DELAY_MS) * REPLY_SCROLL_PX_PER_S / 1000);
+    if (y >= _maxScroll) {
+        y = _maxScroll;
+        _doneTick = lv_tick_get();
+        lv_timer_pause(_timer);
+    }
+    if (y != _scrollY) {
+        _scrollY = y;
+        lv_obj_invalidate(_obj);
+    }
+}
+
+uint32_t AppReplyView::shownFullyMs() {
+    if (_obj == NULL) return 0;
+    if (_maxScroll == 0) return lv_tick_elaps(_shownTick);
+    return _doneTick ? lv_tick_elaps(_doneTick) : 0;
+}
+
+void AppReplyView::getStats(ReplyViewStats* out) {
+    if (out) *out = _stats;
+}
+
+void AppReplyView::resetStats() {
+    uint16_t lines = _stats.lines;
+    uint32_t layoutUs = _stats.layoutUs;
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.lines = lines;
+    _stats.layoutUs = layoutUs;
+}
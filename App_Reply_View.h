@@ -0,0 +1,111 @@
+/**
+ * @file App_Reply_View.h
+ * @brief AI 回复页: 预先断行的滚动文本
+ * @details
+ * lv_label 每次重绘都从头断行、查字形，分块刷屏时一帧要重绘好几次，
+ * 长回复滚动起来开销随字数增长。这里在 setText 时一次断好行，记下每行的字节范围，
+ * 重绘只画与裁剪区相交的几行；断行用的字宽放在一个小的直接映射缓存里。
+ * 中文字体 ui_font_Reply 由 tools/reply_font 按服务端词表生成。没有生成时 hasFont() 为 false，
+ * 用默认字体排版；默认字体画不出的回复 (canDraw() 为 false，通常是中文) 固件不切到回复页。
+ * 主机上的 UI 基准 (tools/ui_bench) 也会编译本文件。只能在 UI 任务里调用。
+ */
+#ifndef APP_REPLY_VIEW_H
+#define APP_REPLY_VIEW_H
+
+#include <stdint.h>
+
+#if defined __has_include
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+#elif __has_include("lvgl/lvgl.h")
+#include "lvgl/lvgl.h"
+#else
+#include "lvgl.h"
+#endif
+#else
+#include "lvgl.h"
+#endif
+
+#define REPLY_TEXT_MAX          512    // 回复文字上限 (字节，UTF-8)
+#define REPLY_MAX_LINES         48
+#define REPLY_LINE_BYTES        96     // 单行最多字节数
+#define REPLY_GLYPH_CACHE       128    // 字宽缓存槽数 (2 的幂)
+#define REPLY_LINE_SPACE        2      // 行间距 (px)
+#define REPLY_PAD               4      // 四周留白 (px)
+#define REPLY_SCROLL_PERIOD_MS  33     // 滚动刷新周期 (约 30fps)
+#define REPLY_SCROLL_DELAY_MS   1500   // 开始滚动前在首屏停留
+#define REPLY_SCROLL_PX_PER_S   24
+
+struct ReplyViewStats {
+    uint32_t layoutUs;      // 最近一次断行耗时
+    uint16_t lines;         // 当前行数
+    uint32_t glyphHits;     // 字宽缓存命中
+    uint32_t glyphMisses;
+    uint32_t linesDrawn;    // 累计绘制的行数 (每个刷屏分块单独计)
+    uint32_t drawUs;        // 累计绘制耗时
+};
+
+class AppReplyView {
+public:
+    // 在 parent 上创建文本区 (屏幕重建后会重新排版已有文字)
+    void create(lv_obj_t* parent);
+
+    // 设置文字，重新断行并回到顶部
+    void setText(const char* utf8);
+
+    // 全部文字显示出来之后经过的毫秒数，还在滚动时返回 0
+    uint32_t shownFullyMs();
+
+    // 中文子集字体是否链接进来了
+    static bool hasFont();
+    // 当前字体能否显示这段文字
+    static bool canDraw(const char* utf8);
+
+    void getStats(ReplyViewStats* out);
+    void resetStats();
+
+private:
+    struct Line {
+        uint16_t start;
+        uint16_t len;
+    };
+    struct GlyphSlot {
+        uint32_t letter;    // 0 = 空槽
+        uint16_t width;
+    };
+
+    static void drawEvent(lv_event_t* e);
+    static void deleteEvent(lv_event_t* e);
+    static void timerCb(lv_timer_t* t);
+
+    void layout();
+    bool pushLine(uint32_t start, uint32_t end);
+    uint16_t glyphWidth(uint32_t letter);
+    void draw(lv_draw_ctx_t* ctx);
+    void scroll();
+
+    lv_obj_t* _obj = NULL;
+    lv_timer_t* _timer = NULL;
+    const lv_font_t* _font = NULL;
+
+    char _text[REPLY_TEXT_MAX] = {0};
+    Line _lines[REPLY_MAX_LINES];
+    uint16_t _lineCount = 0;
+    int32_t _lineHeight = 0;
+    int32_t _scrollY = 0;
+    int32_t _maxScroll = 0;
+    uint32_t _shownTick = 0;    // setText 的 lv_tick
+    uint32_t _doneTick = 0;     // 滚到底的 lv_tick，0 = 还没滚完
+
+    GlyphSlot _glyphs[REPLY_GLYPH_CACHE];
+    ReplyViewStats _stats = {0, 0, 0, 0, 0, 0};
+};
+
+extern AppReplyView MyReplyView;
+
+// 回复屏，按 SquareLine 屏幕的约定命名，由 MyScreens 管理
+extern lv_obj_t* ui_ReplyScreen;
+void ui_ReplyScreen_screen_init(void);
+void ui_ReplyScreen_screen_destroy(void);
+
+#endif
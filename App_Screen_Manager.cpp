@@ -0,0 +1,118 @@
+#include "App_Screen_Manager.h"
+#include <esp_timer.h>
+#include "App_Reply_View.h"
+
+AppScreenManager MyScreens;
+
+struct ScreenEntry {
+    const char* name;
+    lv_obj_t** obj;          // SquareLine 生成的全局屏幕指针
+    void (*init)(void);
+    void (*destroy)(void);
+};
+
+static const ScreenEntry s_screens[SCREEN_COUNT] = {
+    { "main", &ui_MainScreen, ui_MainScreen_screen_init, ui_MainScreen_screen_destroy },
+    { "qr",   &ui_QRScreen,   ui_QRScreen_screen_init,   ui_QRScreen_screen_destroy   },
+    { "reply", &ui_ReplyScreen, ui_ReplyScreen_screen_init, ui_ReplyScreen_screen_destroy },
+};
+
+void AppScreenManager::init() {
+    // 与 ui_init() 相同的全局设置，只是不再构建全部屏幕
+    LV_EVENT_GET_COMP_CHILD = lv_event_register_id();
+
+    lv_disp_t * dispp = lv_disp_get_default();
+    lv_theme_t * theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
+                                               false, LV_FONT_DEFAULT);
+    lv_disp_set_theme(dispp, theme);
+    ui____initial_actions0 = lv_obj_create(NULL);
+
+    build(SCREEN_MAIN);
+    lv_disp_load_scr(ui_MainScreen);
+}
+
+bool AppScreenManager::build(ScreenId id) {
+    const ScreenEntry& e = s_screens[id];
+    if (*e.obj != NULL) return false;
+
+    int64_t t0 = esp_timer_get_time();
+    e.init();
+    _stats.lastBuildUs = (uint32_t)(esp_timer_get_time() - t0);
+    _stats.builds++;
+    sampleHeap();
+    if (_stats.heapKnown) {
+        Serial.printf("[Screen] Built '%s' in %u us, LVGL heap %u B (%u%%, max %u B)\n",
+                      e.name, _stats.lastBuildUs, _stats.heapUsed, _stats.heapUsedPct, _stats.heapMaxUsed);
+    } else {
+        Serial.printf("[Screen] Built '%s' in %u us\n", e.name, _stats.lastBuildUs);
+    }
+    return true;
+}
+
+bool AppScreenManager::show(ScreenId id, lv_scr_load_anim_t anim, uint32_t timeMs) {
+    if (id >= SCREEN_COUNT) return false;
+    bool created = build(id);
+    lv_obj_t* scr = *s_screens[id].obj;
+    if (scr == NULL) return false;
+    if (scr != lv_scr_act()) {
+        // auto_del = false: 离开的屏幕保留，内存紧张时再由 trim() 释放
+        lv_scr_load_anim(scr, anim, timeMs, 0, false);
+    }
+    return created;
+}
+
+bool AppScreenManager::isActive(ScreenId id) {
+    if (id >= SCREEN_COUNT) return false;
+    lv_obj_t* scr = *s_screens[id].obj;
+    return scr != NULL && scr == lv_scr_act();
+}
+
+// 前台屏幕、切换动画中的两块屏幕都不能释放
+bool AppScreenManager::canUnload(ScreenId id) {
+    lv_obj_t* scr = *s_screens[id].obj;
+    if (scr == NULL) return false;
+    lv_disp_t* disp = lv_disp_get_default();
+    if (scr == lv_scr_act()) return false;
+    if (disp && (scr == disp->prev_scr || scr == disp->scr_to_load)) return false;
+    return true;
+}
+
+int AppScreenManager::trim() {
+    int count = 0;
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        if (!canUnload((ScreenId)i)) continue;
+        s_screens[i].destroy();
+        _stats.unloads++;
+        count++;
+        Serial.printf("[Screen] Unloaded '%s'\n", s_screens[i].name);
+    }
+    if (count) sampleHeap();
+    return count;
+}
+
+void AppScreenManager::sampleHeap() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    // LV_MEM_CUSTOM: LVGL 直接用系统堆，内部 RAM 的占用里还有 WiFi、4G、音频，不能当成 LVGL 的
+    _stats.heapKnown = mon.total_size != 0;
+    if (!_stats.heapKnown) {
+        _stats.heapUsed = 0;
+        _stats.heapMaxUsed = 0;
+        _stats.heapUsedPct = 0;
+        return;
+    }
+    _stats.heapUsed = mon.total_size - mon.free_size;
+    _stats.heapMaxUsed = mon.max_used;
+    _stats.heapUsedPct = mon.used_pct;
+}
+
+void AppScreenManager::loop() {
+    sampleHeap();
+    if (_stats.heapKnown && _stats.heapUsedPct >= SCREEN_TRIM_USED_PCT) {
+        trim();
+    }
+}
+
+void AppScreenManager::getStats(ScreenStats* out) {
+    if (out) *out = _stats;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file App_Screen_Manager.h
+ * @brief 屏幕管理: 首次使用时才构建，内存紧张时释放后台屏幕
+ * @details
+ * 取代 ui_init() 开机一次性构建全部 SquareLine 屏幕的做法。
+ * 新增屏幕只需在 App_Screen_Manager.cpp 的 s_screens 表里登记 init/destroy 函数。
+ * 按 LVGL 自带堆 (LV_MEM_CUSTOM = 0) 的使用率决定是否释放后台屏幕；LV_MEM_CUSTOM 时
+ * LVGL 直接用系统堆，分不出自己的占用，不做自动释放 (trim() 仍可手动调用)。
+ * 只能在 UI 任务里调用。
+ */
+#ifndef APP_SCREEN_MANAGER_H
+#define APP_SCREEN_MANAGER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "ui.h"
+
+enum ScreenId : uint8_t {
+    SCREEN_MAIN = 0,
+    SCREEN_QR,
+    SCREEN_REPLY,
+    SCREEN_COUNT
+};
+
+// LVGL 堆使用率超过这个值时释放不在前台的屏幕 (只在 LVGL 堆可测时)
+#define SCREEN_TRIM_USED_PCT  70
+
+struct ScreenStats {
+    uint32_t builds;        // 构建次数 (含重建)
+    uint32_t unloads;       // 因内存紧张释放的次数
+    uint32_t lastBuildUs;   // 最近一次构建耗时
+    uint32_t heapUsed;      // 当前 LVGL 堆占用
+    uint32_t heapMaxUsed;   // LVGL 堆高水位
+    uint8_t  heapUsedPct;
+    bool     heapKnown;     // false: LV_MEM_CUSTOM，上面三项无效
+};
+
+class AppScreenManager {
+public:
+    // 设置主题并只构建主屏 (替代 ui_init)
+    void init();
+
+    // 切换到指定屏幕，没构建过就先构建。返回 true 表示本次是新构建的 (需要重新绑定控件)
+    bool show(ScreenId id, lv_scr_load_anim_t anim = LV_SCR_LOAD_ANIM_NONE, uint32_t timeMs = 0);
+
+    bool isActive(ScreenId id);
+
+    // 周期调用: 更新堆统计，内存紧张时释放后台屏幕
+    void loop();
+
+    // 释放所有不在前台的屏幕，返回释放的个数
+    int trim();
+
+    void getStats(ScreenStats* out);
+
+private:
+    bool build(ScreenId id);
+    bool canUnload(ScreenId id);
+    void sampleHeap();
+
+    ScreenStats _stats = {0, 0, 0, 0, 0, 0, false};
+};
+
+extern AppScreenManager MyScreens;
+
+#endif
@@ -9,6 +9,7 @@
 #include "App_UI_Logic.h"
 #include "App_Sys.h"
 #include "Arduino.h"
+#include <ArduinoJson.h>
 
 AppServer MyServer;
 
@@ -24,20 +25,48 @@ uint8_t hexCharToVal(char c) {
     return 0;
 }
 
-// 4G 模式下手动发送整数
-bool sendIntManual(uint32_t val) {
-    uint8_t buf[4];
-    buf[0] = (val >> 24) & 0xFF;
-    buf[1] = (val >> 16) & 0xFF;
-    buf[2] = (val >> 8)  & 0xFF;
-    buf[3] = (val)       & 0xFF;
-    return My4G.sendData(buf, 4);
+// 字节数 / 毫秒 -> kbps (饱和到 uint16)
+static uint16_t toKbps(uint32_t bytes, uint32_t ms) {
+    if (ms == 0) ms = 1;
+    uint32_t kbps = (uint32_t)((uint64_t)bytes * 8 / ms);
+    return kbps > 0xFFFF ? 0xFFFF : (uint16_t)kbps;
 }
 
 // ==========================================
 //  类成员函数实现
 // ==========================================
 
+size_t AppServer::buildRequestHeader(uint8_t* buf, bool isWiFi) {
+    int csq = My4G.getCachedCSQ();
+    int rssi = isWiFi ? MyWiFi.getRSSI() : (csq == 99 ? -113 : -113 + 2 * csq); // CSQ -> dBm
+    uint32_t bufFree = MyAudio.getPlayBufferFree();
+    _burstBytes = bufFree / PANEL_BURST_DEN * PANEL_BURST_NUM;
+
+    // 换了链路，上次测的吞吐不再适用
+    uint8_t transport = isWiFi ? TRANSPORT_WIFI : TRANSPORT_4G;
+    if (transport != _lastTransport) {
+        _uplinkKbps = 0;
+        _downlinkKbps = 0;
+        _lastTransport = transport;
+    }
+
+    memcpy(buf, PANEL_HDR_MAGIC, 4);
+    buf[4]  = PANEL_HDR_VERSION;
+    buf[5]  = transport;
+    buf[6]  = (uint8_t)csq;
+    buf[7]  = (uint8_t)(int8_t)constrain(rssi, -128, 0);
+    buf[8]  = _uplinkKbps >> 8;   buf[9]  = _uplinkKbps & 0xFF;
+    buf[10] = _downlinkKbps >> 8; buf[11] = _downlinkKbps & 0xFF;
+    buf[12] = (_burstBytes >> 24) & 0xFF;
+    buf[13] = (_burstBytes >> 16) & 0xFF;
+    buf[14] = (_burstBytes >> 8)  & 0xFF;
+    buf[15] = (_burstBytes)       & 0xFF;
+
+    Serial.printf("[Server] Link: %s CSQ=%d RSSI=%d up=%dkbps down=%dkbps buf=%u burst=%u\n",
+                  isWiFi ? "WiFi" : "4G", csq, rssi, _uplinkKbps, _downlinkKbps, bufFree, _burstBytes);
+    return PANEL_HDR_SIZE;
+}
+
 // [核心] 必须实现 init 函数，否则连接器找不到符号
 void AppServer::init(const char* ip, uint16_t port) {
     this->_server_ip = ip;
@@ -70,14 +99,17 @@ void AppServer::chatWithServer(Client* networkClient) {
     uint32_t audioSize = MyAudio.record_data_len;
     MyUILogic.updateAssistantStatus("发送指令...");
     
+    // 请求头 (链路信息) + 长度头 (Big Endian)，一次发出
+    uint8_t hdrBuf[PANEL_HDR_SIZE + 4];
+    size_t hdrLen = buildRequestHeader(hdrBuf, isWiFi);
+    hdrBuf[hdrLen++] = (audioSize >> 24) & 0xFF;
+    hdrBuf[hdrLen++] = (audioSize >> 16) & 0xFF;
+    hdrBuf[hdrLen++] = (audioSize >> 8)  & 0xFF;
+    hdrBuf[hdrLen++] = (audioSize)       & 0xFF;
+
+    uint32_t uploadStart = millis();
     if (isWiFi) { 
-        // 发送长度头 (Big Endian)
-        uint8_t lenBuf[4];
-        lenBuf[0] = (audioSize >> 24) & 0xFF;
-        lenBuf[1] = (audioSize >> 16) & 0xFF;
-        lenBuf[2] = (audioSize >> 8)  & 0xFF;
-        lenBuf[3] = (audioSize)       & 0xFF;
-        networkClient->write(lenBuf, 4);
+        networkClient->write(hdrBuf, hdrLen);
         // 发送本体
         networkClient->write(MyAudio.record_buffer, audioSize);
         networkClient->flush(); 
@@ -85,7 +117,8 @@ void AppServer::chatWithServer(Client* networkClient) {
     else {
         // 4G 发送
         delay(200);
-        if(!sendIntManual(audioSize)) { 
+        uploadStart = millis();
+        if(!My4G.sendData(hdrBuf, hdrLen)) { 
             My4G.closeTCP(); 
             MyUILogic.finishAIState();
             return; 
@@ -100,8 +133,11 @@ void AppServer::chatWithServer(Client* networkClient) {
             vTaskDelay(pdMS_TO_TICKS(5));
         }
     }
+    _uplinkKbps = toKbps(audioSize + hdrLen, millis() - uploadStart);
     
     MyUILogic.updateAssistantStatus("思考中...");
+    // 每次请求由服务端重新选下行采样率，回复里没有 (旧服务端、JSON 没解析出来) 就是 16k
+    MyAudio.setStreamRate(AUDIO_SAMPLE_RATE);
 
     // 3. 接收并解析 (新版：JOSN Hex -> Audio Binary Stream)
     
@@ -114,6 +150,8 @@ void AppServer::chatWithServer(Client* networkClient) {
     // 缓冲区 (ADPCM块) 
     uint8_t streamBuf[256]; 
     unsigned long lastDataTime = millis();
+    uint32_t audioStartTime = 0;
+    uint32_t burstEndTime = 0;     // 收满 _burstBytes 的时间
     
     while (1) {
         // 检查连接是否断开 (EOF)
@@ -174,6 +212,14 @@ void AppServer::chatWithServer(Client* networkClient) {
                                 for (int k=0; k<jLen; k++) jBuf[k] = (hexCharToVal(jsonHex[k*2]) << 4) | hexCharToVal(jsonHex[k*2+1]);
                                 jBuf[jLen] = 0;
                                 Serial.printf("[Protocol] JSON: %s\n", jBuf);
+
+                                // 服务端按链路选的下行采样率 (旧服务端没有该字段 -> 16k)
+                                StaticJsonDocument<32> filter;
+                                filter["audio_rate"] = true;
+                                StaticJsonDocument<64> meta;
+                                deserializeJson(meta, jBuf, DeserializationOption::Filter(filter));
+                                MyAudio.setStreamRate(meta["audio_rate"] | (uint32_t)AUDIO_SAMPLE_RATE);
+
                                 MyUILogic.handleAICommand(String(jBuf));
                                 free(jBuf);
                             }
@@ -186,8 +232,10 @@ void AppServer::chatWithServer(Client* networkClient) {
                     // Phase 2: Audio (Raw Binary ADPCM)
                     // 直接推入播放缓冲 -> 后台解码任务会自动消费
                     // 这里不需要做任何处理，直接是 ADPCM 字节
+                    if (totalBytesReceived == 0) audioStartTime = millis();
                     MyAudio.pushToPlayBuffer(&c, 1);
                     totalBytesReceived++;
+                    if (totalBytesReceived == _burstBytes) burstEndTime = millis();
                     if (totalBytesReceived % 1024 == 0) Serial.print(".");
                 }
             }
@@ -197,6 +245,12 @@ void AppServer::chatWithServer(Client* networkClient) {
     }
 
     Serial.printf("\n[Server] Stream Finished. Total: %d bytes.\n", totalBytesReceived);
+    // 下行吞吐只算服务端不限速的开头一段: 之后服务端按播放速度发，测到的是码率而不是链路，
+    // 降到 8k 后就再也测不到 16k 够用了。数据量太少时不更新 (短回复测不准)
+    bool burstOnly = totalBytesReceived < _burstBytes;
+    uint32_t measured = burstOnly ? totalBytesReceived : _burstBytes;
+    uint32_t endTime = burstOnly ? lastDataTime : burstEndTime;
+    if (measured > 4096) _downlinkKbps = toKbps(measured, endTime - audioStartTime);
 
     // 等待播放缓冲排空 (给一点时间让 tail 追上 head)
     // 但不要死等，因为 playAudioTask 会一直运行
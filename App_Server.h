@@ -5,6 +5,23 @@
 #include <Client.h>     // 引入基类 Client
 #include <WiFiClient.h> // 引入 WiFiClient
 
+// [自适应码率] 请求头: 魔数 "PNL1" + 12 字节链路信息，然后才是原来的 4 字节长度 + ADPCM
+// 链路信息 (大端): ver(1) transport(1) csq(1) rssi(1,有符号) up_kbps(2) down_kbps(2) burst_bytes(4)
+// burst_bytes: 服务端开头可以不限速发送的字节数 (播放缓冲空闲的 PANEL_BURST_NUM/DEN)，
+// 之后按播放速度发。比例只在这里定义，服务端直接用这个字节数
+// 旧版服务端/设备没有魔数，服务端据此兼容
+#define PANEL_HDR_MAGIC      "PNL1"
+#define PANEL_HDR_VERSION    2
+#define PANEL_HDR_SIZE       16
+// 下行吞吐只在不限速的这一段里测
+#define PANEL_BURST_NUM      3
+#define PANEL_BURST_DEN      4
+
+enum PanelTransport : uint8_t {
+    TRANSPORT_WIFI = 0,
+    TRANSPORT_4G   = 1
+};
+
 class AppServer {
 public:
     void init(const char* ip, uint16_t port);
@@ -20,6 +37,15 @@ private:
     bool waitForData(Client* client, size_t len, uint32_t timeout_ms);
     bool readBigEndianInt(Client* client, uint32_t *val);
     void sendBigEndianInt(Client* client, uint32_t val);
+
+    // 生成请求头 (PANEL_HDR_SIZE 字节)
+    size_t buildRequestHeader(uint8_t* buf, bool isWiFi);
+
+    // 上一次请求实测的上/下行吞吐 (kbps)，0 表示未知；WiFi/4G 切换后清零
+    uint16_t _uplinkKbps = 0;
+    uint16_t _downlinkKbps = 0;
+    uint8_t _lastTransport = 0xFF;
+    uint32_t _burstBytes = 0;     // 本次请求服务端不限速发送的字节数
 };
 
 extern AppServer MyServer;
@@ -0,0 +1,100 @@
+#include "App_Status_Bar.h"
+
+AppStatusBar MyStatusBar;
+
+void AppStatusBar::invalidate() {
+    _valid = false;
+}
+
+void AppStatusBar::getStats(StatusBarStats* out) {
+    if (out) *out = _stats;
+}
+
+void AppStatusBar::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+// 主屏被 MyScreens 释放时一起丢掉控件指针
+void AppStatusBar::onPanelDeleted(lv_event_t* e) {
+    AppStatusBar* self = (AppStatusBar*)lv_event_get_user_data(e);
+    self->_panel = NULL;
+    self->_labelTemp = NULL;
+    self->_valid = false;
+}
+
+// 主界面被销毁重建后 ui_PanelTopTitle 会变，需要重新挂温度标签
+void AppStatusBar::attach() {
+    if (_panel == ui_PanelTopTitle) return;
+    _panel = ui_PanelTopTitle;
+    _labelTemp = NULL;
+    _valid = false;
+    if (_panel == NULL) return;
+    lv_obj_add_event_cb(_panel, onPanelDeleted, LV_EVENT_DELETE, this);
+
+    // 给温度腾位置，见 App_Status_Bar.h 的布局说明
+    if (ui_LabelTime) lv_obj_set_x(ui_LabelTime, STATUS_TIME_X);
+
+    _labelTemp = lv_label_create(_panel);
+    lv_obj_set_width(_labelTemp, STATUS_TEMP_W);
+    lv_obj_set_height(_labelTemp, LV_SIZE_CONTENT);
+    lv_obj_set_x(_labelTemp, STATUS_TEMP_X);
+    lv_obj_set_y(_labelTemp, 0);
+    lv_obj_set_align(_labelTemp, LV_ALIGN_CENTER);
+    lv_obj_set_style_text_align(_labelTemp, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_label_set_long_mode(_labelTemp, LV_LABEL_LONG_CLIP);
+    lv_label_set_text(_labelTemp, "");
+}
+
+// 记录一次控件改动
+void AppStatusBar::touch(lv_obj_t* obj) {
+    _stats.invalidations++;
+    _stats.touchedPx += (uint32_t)lv_obj_get_width(obj) * lv_obj_get_height(obj);
+}
+
+void AppStatusBar::update(const StatusBarState& state) {
+    attach();
+    if (_panel == NULL) return;
+    _stats.updates++;
+
+    if (ui_Bar4gsignal && (!_valid || state.signalPercent != _shown.signalPercent)) {
+        // 首次绘制不做动画
+        lv_bar_set_value(ui_Bar4gsignal, state.signalPercent < 0 ? 0 : state.signalPercent,
+                         _valid ? LV_ANIM_ON : LV_ANIM_OFF);
+        touch(ui_Bar4gsignal);
+    }
+
+    if (ui_LabelTime && state.minuteOfDay >= 0 && (!_valid || state.minuteOfDay != _shown.minuteOfDay)) {
+        char timeStr[8];
+        snprintf(timeStr, sizeof(timeStr), "%02d:%02d", state.minuteOfDay / 60, state.minuteOfDay % 60);
+        lv_label_set_text(ui_LabelTime, timeStr);
+        touch(ui_LabelTime);
+    }
+
+    if (ui_LabelTxt4G && (!_valid || state.netType != _shown.netType)) {
+        const char* txt = (state.netType == STATUS_NET_WIFI) ? "WiFi" :
+                          (state.netType == STATUS_NET_4G)   ? "4G"   : "--";
+        lv_label_set_text_static(ui_LabelTxt4G, txt);
+        touch(ui_LabelTxt4G);
+    }
+
+    // 离当前显示值超过半度加回差才换，标签宽度只够 3 个字符，限制在 -9~99
+    int16_t deci = state.temperatureDeci;
+    int16_t tempC = _tempShownC;
+    if (!_valid || abs(deci - _tempShownC * 10) >= 5 + STATUS_TEMP_HYST_DECI) {
+        tempC = (deci >= 0) ? (deci + 5) / 10 : (deci - 5) / 10;
+        tempC = constrain(tempC, -9, 99);
+    }
+    if (_labelTemp && (!_valid || tempC != _tempShownC)) {
+        char tempStr[8];
+        snprintf(tempStr, sizeof(tempStr), "%dC", tempC);
+        lv_label_set_text(_labelTemp, tempStr);
+        touch(_labelTemp);
+    }
+    _tempShownC = tempC;
+
+    // 时间未同步时保持上一次显示的值
+    int16_t lastMinute = _shown.minuteOfDay;
+    _shown = state;
+    if (state.minuteOfDay < 0 && _valid) _shown.minuteOfDay = lastMinute;
+    _valid = true;
+}
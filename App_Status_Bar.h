@@ -0,0 +1,74 @@
+/**
+ * @file App_Status_Bar.h
+ * @brief 主界面顶部状态栏 (信号 / 时间 / 网络类型 / 温度)
+ * @details
+ * 调用方每次给出完整的状态快照，这里和上一次画到屏幕上的值逐项比较，
+ * 只有变化的控件才会调用 LVGL 接口 (从而才会触发重绘)。
+ * 只能在 UI 任务里调用。
+ */
+#ifndef APP_STATUS_BAR_H
+#define APP_STATUS_BAR_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "ui.h"
+
+// 温度回差 (0.1°C): 超过取整边界这么多才换显示值，避免 x.5 附近每秒来回跳
+#ifndef STATUS_TEMP_HYST_DECI
+#define STATUS_TEMP_HYST_DECI  3
+#endif
+
+// 顶栏布局 (相对面板中心，montserrat_14):
+// "4G" -60~-40, 信号条 -36~-16, SquareLine 原来的时间 x=24 占 4~44，右边放不下温度，
+// 所以时间左移到 x=8 (-12~28)，温度用固定宽度右对齐放在 34~62 (面板边框内)
+#define STATUS_TIME_X          8
+#define STATUS_TEMP_X          48
+#define STATUS_TEMP_W          28
+
+enum StatusNetType : uint8_t {
+    STATUS_NET_NONE = 0,
+    STATUS_NET_WIFI,
+    STATUS_NET_4G
+};
+
+// 状态栏视图模型，-1 / STATUS_NET_NONE 表示未知
+struct StatusBarState {
+    int8_t  signalPercent;   // 0~100
+    int16_t minuteOfDay;     // 0~1439
+    StatusNetType netType;
+    int16_t temperatureDeci; // 0.1°C
+};
+
+struct StatusBarStats {
+    uint32_t updates;        // update() 调用次数
+    uint32_t invalidations;  // 实际改动控件的次数
+    uint32_t touchedPx;      // 被改动控件外框面积累计 (像素)，不是 LVGL 实际重绘的面积
+};
+
+class AppStatusBar {
+public:
+    // 与当前状态比较，只刷新变化的控件
+    void update(const StatusBarState& state);
+
+    // 屏幕重建后调用，下次 update 全量刷新
+    void invalidate();
+
+    void getStats(StatusBarStats* out);
+    void resetStats();
+
+private:
+    void attach();
+    static void onPanelDeleted(lv_event_t* e);
+    void touch(lv_obj_t* obj);
+
+    lv_obj_t* _panel = NULL;       // 当前绑定的 ui_PanelTopTitle
+    lv_obj_t* _labelTemp = NULL;   // 温度标签 (SquareLine 没有，代码创建)
+    StatusBarState _shown;
+    int16_t _tempShownC = 0;       // 温度标签上的整数值 (带回差)
+    bool _valid = false;
+    StatusBarStats _stats = {0, 0, 0};
+};
+
+extern AppStatusBar MyStatusBar;
+
+#endif
@@ -1,6 +1,7 @@
 #include "App_Sys.h"
 #include <math.h> 
 #include "Pin_Config.h"
+#include "App_Bus.h"
 
 AppSys MySys;
 
@@ -21,9 +22,20 @@ void AppSys::init() {
     analogSetAttenuation(ADC_11db); 
     pinMode(PIN_ADC_TEMP, INPUT);
 
-    // 2. 按键初始化
+    // 2. 按键初始化: 双边沿中断 + 消抖/长按定时器，不再轮询
     #ifdef PIN_KEY2
     pinMode(PIN_KEY2, INPUT_PULLUP);
+    esp_timer_create_args_t args = {};
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.callback = onKeyDebounced;
+    args.name = "key_debounce";
+    esp_timer_create(&args, &_debounceTimer);
+    args.callback = onKeyLongPress;
+    args.name = "key_long";
+    esp_timer_create(&args, &_longPressTimer);
+    _keyDown = digitalRead(PIN_KEY2) == LOW;
+    attachInterrupt(digitalPinToInterrupt(PIN_KEY2), onKeyEdge, CHANGE);
     #endif
 
     Serial.println("[Sys] System Monitor Initialized.");
@@ -72,44 +84,52 @@ void AppSys::scanLoop() {
     }
 }
 
-// 按键逻辑
-KeyAction AppSys::getKeyAction() {
-    static bool lastState = HIGH; 
-    
-    #ifdef PIN_KEY2
-    bool currentState = digitalRead(PIN_KEY2);
-    #else
-    bool currentState = HIGH;
-    #endif
+// ================= 按键 =================
+#ifdef PIN_KEY2
+// 每个边沿 (含抖动) 都把消抖定时器推迟，电平稳定 KEY_DEBOUNCE_MS 后才读
+void IRAM_ATTR AppSys::onKeyEdge() {
+    esp_timer_stop(MySys._debounceTimer);
+    esp_timer_start_once(MySys._debounceTimer, KEY_DEBOUNCE_MS * 1000);
+}
 
-    KeyAction action = KEY_NONE;
+// 以下都在 esp_timer 任务里执行，状态不需要加锁
+void AppSys::onKeyDebounced(void* arg) {
+    AppSys* self = (AppSys*)arg;
+    bool down = digitalRead(PIN_KEY2) == LOW;
+    if (down == self->_keyDown) return;   // 抖完又回到原来的电平
+    self->_keyDown = down;
 
-    if (lastState == HIGH && currentState == LOW) {
-        _pressStartTime = millis();
-        _isLongPressHandled = false;
+    if (down) {
+        self->_longFired = false;
+        esp_timer_start_once(self->_longPressTimer, KEY_LONG_PRESS_MS * 1000);
+        self->emitKey(KEY_PRESS);
+        return;
     }
-    
-    if (currentState == LOW) {
-        if (millis() - _pressStartTime > 800) { 
-            if (!_isLongPressHandled) {
-                action = KEY_LONG_PRESS_START; 
-                _isLongPressHandled = true;   
-            } else {
-                action = KEY_LONG_PRESS_HOLD; 
-            }
-        }
+
+    esp_timer_stop(self->_longPressTimer);
+    if (self->_longFired) {
+        self->emitKey(KEY_LONG_PRESS_END);
+        return;
     }
-    
-    if (lastState == LOW && currentState == HIGH) {
-        if (_isLongPressHandled) {
-            action = KEY_LONG_PRESS_END;
-        } else {
-            if (millis() - _pressStartTime > 50) {
-                action = KEY_SHORT_PRESS;
-            }
-        }
+    uint32_t now = millis();
+    if (self->_lastClickMs != 0 && now - self->_lastClickMs < KEY_DOUBLE_CLICK_MS) {
+        self->_lastClickMs = 0;
+        self->emitKey(KEY_DOUBLE_CLICK);
+    } else {
+        self->_lastClickMs = now;
+        self->emitKey(KEY_SHORT_PRESS);
     }
-    
-    lastState = currentState;
-    return action;
-}
\ No newline at end of file
+}
+
+void AppSys::onKeyLongPress(void* arg) {
+    AppSys* self = (AppSys*)arg;
+    if (!self->_keyDown) return;
+    self->_longFired = true;
+    self->_lastClickMs = 0;   // 长按不参与双击
+    self->emitKey(KEY_LONG_PRESS_START);
+}
+
+void AppSys::emitKey(KeyAction action) {
+    MyBus.publish(BUS_KEY, action);
+}
+#endif
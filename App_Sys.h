@@ -5,33 +5,23 @@
 #include "Pin_Config.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-#include <freertos/queue.h> // 确保包含队列定义
+#include <esp_timer.h>
 
-// --- 1. 定义按键动作 ---
+// --- 1. 定义按键动作 (只有边沿事件，按住期间不重复发) ---
 enum KeyAction {
     KEY_NONE,
     KEY_SHORT_PRESS,      // 短按松开
-    KEY_LONG_PRESS_START, // 长按触发
-    KEY_LONG_PRESS_HOLD,  // 长按保持
-    KEY_LONG_PRESS_END    // 长按结束
+    KEY_LONG_PRESS_START, // 按住超过 KEY_LONG_PRESS_MS
+    KEY_LONG_PRESS_END,   // 长按后松开
+    KEY_PRESS,            // 按下 (消抖后立即发)
+    KEY_DOUBLE_CLICK      // 两次短按间隔小于 KEY_DOUBLE_CLICK_MS (代替第二次的 SHORT_PRESS)
 };
 
-// --- 2. 定义网络消息结构 ---
-enum NetEventType {
-    NET_EVENT_NONE,
-    NET_EVENT_UPLOAD_AUDIO  // 上传录音指令
-};
-
-struct NetMessage {
-    NetEventType type;
-    uint8_t* data;      // 指向音频数据的指针
-    size_t len;         // 数据长度
-};
+#define KEY_DEBOUNCE_MS      20     // 最后一个边沿之后电平保持这么久才算数
+#define KEY_LONG_PRESS_MS    800
+#define KEY_DOUBLE_CLICK_MS  400    // 两次松开之间
 
-// 声明全局队列句柄
-extern QueueHandle_t NetQueue_Handle;
-
-// --- 3. AppSys 类定义 ---
+// --- 2. AppSys 类定义 ---
 class AppSys {
 public:
     void init();
@@ -43,12 +33,18 @@ public:
     // 核心循环
     void scanLoop(); 
 
-    // 按键获取
-    KeyAction getKeyAction();
-
 private:
-    uint32_t _pressStartTime = 0;
-    bool _isLongPressHandled = false;
+    // 按键: GPIO 中断只重启消抖定时器，状态机在 esp_timer 任务里跑，事件发到总线 (BUS_KEY)
+    static void IRAM_ATTR onKeyEdge();
+    static void onKeyDebounced(void* arg);
+    static void onKeyLongPress(void* arg);
+    void emitKey(KeyAction action);
+
+    esp_timer_handle_t _debounceTimer = NULL;
+    esp_timer_handle_t _longPressTimer = NULL;
+    bool _keyDown = false;
+    bool _longFired = false;
+    uint32_t _lastClickMs = 0;
 };
 
 extern AppSys MySys;
@@ -7,13 +7,118 @@
 #include <ArduinoJson.h> 
 #include "App_Sys.h"
 #include "App_IR.h"
+#include "App_AC.h"
+#include "App_IR_Library.h"
+#include "App_Status_Bar.h"
+#include "App_QR_Cache.h"
+#include "App_Screen_Manager.h"
+
+extern volatile float g_SystemTemp;
 
 AppUILogic MyUILogic;
 
 
+// ================= 跨任务命令 =================
+// 其它任务只往事件总线上发 BUS_UI 事件或置 _pending 标志，UI 任务在两帧之间统一执行，
+// 双方都不再为 LVGL 抢锁。
+
+// 拷贝 UTF-8 文本，截断时退回到完整字符边界
+static void copyUtf8(char* dst, size_t cap, const char* src) {
+    size_t n = strlen(src);
+    if (n >= cap) {
+        n = cap - 1;
+        while (n > 0 && ((uint8_t)src[n] & 0xC0) == 0x80) n--;
+    }
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+}
+
+bool AppUILogic::postCommand(UICmdType type, int32_t param, const char* text) {
+    if (!MyBus.publishText(BUS_UI, type, param, text)) {
+        Serial.printf("[UI] Command queue full, dropped type %d\n", type);
+        return false;
+    }
+    return true;
+}
+
+void AppUILogic::setPending(uint8_t bits) {
+    _pending.fetch_or(bits);
+    MyDisplay.wake();
+}
+
+void AppUILogic::processEvents() {
+    applyPending();
+
+    BusEvent evt;
+    while (MyBus.poll(_busSub, evt)) {
+        switch (evt.topic) {
+            case BUS_KEY:
+                Serial.printf("[UI] Key Received: %d\n", evt.kind);
+                // 熄屏时按下只用来亮屏，这一次按键后续的松开/长按都不处理
+                if (evt.kind == KEY_PRESS) _keyWakeOnly = MyDisplay.noteActivity();
+                else MyDisplay.noteActivity();
+                if (!_keyWakeOnly) handleInput((KeyAction)evt.kind);
+                break;
+            case BUS_UI:
+                applyCommand(evt);
+                break;
+            case BUS_REMOTE:
+                if (evt.kind == REMOTE_TOGGLE) MyDisplay.toggleBacklight();
+                break;
+            case BUS_RECORDED:
+                sendAudioToPC();
+                break;
+        }
+    }
+}
+
+// 按 状态 -> 回复 -> 结束 的顺序处理，和网络任务设置它们的顺序一致
+void AppUILogic::applyPending() {
+    uint8_t pending = _pending.exchange(0);
+    if (pending == 0) return;
+    MyDisplay.noteActivity();   // AI 流程的进展要让用户看到
+
+    if (pending & UI_PENDING_STATUS) {
+        char text[UI_STATUS_TEXT_MAX];
+        portENTER_CRITICAL(&_textMux);
+        memcpy(text, _statusText, sizeof(text));
+        portEXIT_CRITICAL(&_textMux);
+        Serial.printf("[UI Status] %s\n", text);
+        // 如果有状态 Label，在这里更新
+        // if(ui_LabelStatus) lv_label_set_text(ui_LabelStatus, text);
+    }
+
+    if (pending & UI_PENDING_REPLY) showReplyScreen();
+
+    if (pending & UI_PENDING_FINISH) {
+        Serial.println("[UI] AI Process Finished. Restoring UI.");
+        if(ui_ButtonAI) {
+            lv_obj_clear_flag(ui_ButtonAI, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_set_style_bg_color(ui_ButtonAI, lv_color_hex(0xF9F9F9), LV_PART_MAIN | LV_STATE_DEFAULT);
+        }
+        if(ui_ButtonLink) lv_obj_clear_flag(ui_ButtonLink, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void AppUILogic::applyCommand(const BusEvent& evt) {
+    switch (evt.kind) {
+        case UI_CMD_SIGNAL:
+            _cachedCSQ = evt.param;
+            break;
+    }
+}
+
 // [新增] 设置信号值
 void AppUILogic::setSignalCSQ(int csq) {
-    _cachedCSQ = csq;
+    postCommand(UI_CMD_SIGNAL, csq, NULL);
+}
+
+// 二维码内容跟着 IMEI 走，后台重新编码，在二维码页上时 loop() 换上新图
+void AppUILogic::setIMEI(const char* imei) {
+    if (imei == NULL || imei[0] == '\0') return;
+    char content[QR_PAYLOAD_MAX];
+    snprintf(content, sizeof(content), "IMEI:%s", imei);
+    MyQRCache.request(QR_SLOT_IMEI, content);
 }
 
 // --- [核心修复] 适配新的 JSON 结构并防止空指针崩溃 ---
@@ -28,7 +133,11 @@ void AppUILogic::handleAICommand(String jsonString) {
         return;
     }
 
-    // 2. 检查是否有 control 字段
+    // 2. 回复文字 (与控制指令无关，先显示)
+    const char* reply = doc["reply_text"];
+    if (reply && reply[0]) showReplyText(reply);
+
+    // 3. 检查是否有 control 字段
     if (!doc.containsKey("control")) {
         Serial.println("[AI] JSON 缺少 control 字段");
         return;
@@ -40,7 +149,7 @@ void AppUILogic::handleAICommand(String jsonString) {
         return;
     }
 
-    // 3. 安全读取字段 (增加空指针检查)
+    // 4. 安全读取字段 (增加空指针检查)
     const char* target = doc["control"]["target"]; // "空调", "灯"
     const char* action = doc["control"]["action"]; // "开", "关"
     const char* value  = doc["control"]["value"];  // "25", "高"
@@ -52,18 +161,16 @@ void AppUILogic::handleAICommand(String jsonString) {
 
     Serial.printf("[AI] 执行指令: Target=%s, Action=%s, Value=%s\n", target, action, value);
 
-    // 4. 执行具体逻辑 (示例)
+    // 5. 执行具体逻辑
     if (strcmp(target, "空调") == 0) {
-        if (strcmp(action, "开") == 0) {
-             Serial.println(">>> 正在开启空调...");
-        } else if (strcmp(action, "关") == 0) {
-             Serial.println(">>> 正在关闭空调...");
-        } else if (strcmp(action, "调节") == 0) {
-             Serial.printf(">>> 调节空调温度至: %s\n", value);
-        }
-
-        // [新增] 检查是否有 ir_code 并发送
-        if (doc["control"].containsKey("ir_code")) {
+        // 按 params 在本机改空调状态、组帧发送；服务端算好的 ir_code 只在没有 params 时 (旧服务端) 使用
+        JsonObject params = doc["control"]["params"];
+        if (!params.isNull()) {
+            int temp = params["temperature"] | 0;
+            int tempDelta = params["temp_delta"] | 0;
+            if (temp == 0 && value[0] >= '0' && value[0] <= '9') temp = atoi(value);
+            MyAC.applyVoice(action, temp, tempDelta, params["mode"].as<const char*>(), params["fan"].as<const char*>());
+        } else if (doc["control"].containsKey("ir_code")) {
             const char* ir_code = doc["control"]["ir_code"];
             if (ir_code && strlen(ir_code) > 0) {
                 Serial.printf("[IRQ] 执行红外发送: %s\n", ir_code);
@@ -71,6 +178,12 @@ void AppUILogic::handleAICommand(String jsonString) {
             }
         }
     } 
+    else if (strcmp(target, "遥控") == 0) {
+        // 学习过的遥控按键，按名字重放
+        const char* irName = doc["control"]["ir_name"];
+        if (irName && irName[0]) MyIRLib.send(irName);
+        else Serial.println("[AI] 遥控指令缺少 ir_name");
+    }
     else if (strcmp(target, "灯") == 0) {
         if (strcmp(action, "开") == 0) {
              Serial.println(">>> 开灯");
@@ -81,38 +194,48 @@ void AppUILogic::handleAICommand(String jsonString) {
 }
 
 void AppUILogic::init() {
+    _busSub = MyBus.subscribe("UI", BUS_BIT(BUS_KEY) | BUS_BIT(BUS_UI) | BUS_BIT(BUS_REMOTE) | BUS_BIT(BUS_RECORDED));
     _uiGroup = lv_group_create();
-    
+    bindMainScreen();
+
+    configTime(8 * 3600, 0, "ntp.aliyun.com", "pool.ntp.org");
+
+    // 二维码在后台编码，IMEI 读到后 (setIMEI) 才有内容
+    MyQRCache.init();
+    Serial.println("[UI Logic] Init Done.");
+}
+
+// 主屏 (重新) 构建后把按钮加入焦点组
+void AppUILogic::bindMainScreen() {
+    lv_group_remove_all_objs(_uiGroup);
+
     // 安全添加对象
     if(ui_ButtonAI) lv_group_add_obj(_uiGroup, ui_ButtonAI);
     if(ui_ButtonLink) lv_group_add_obj(_uiGroup, ui_ButtonLink);
     
     if(ui_ButtonAI) lv_group_focus_obj(ui_ButtonAI);
-
-    configTime(8 * 3600, 0, "ntp.aliyun.com", "pool.ntp.org");
-    Serial.println("[UI Logic] Init Done.");
 }
 
 void AppUILogic::toggleFocus() {
     if (_uiGroup) {
         lv_group_focus_next(_uiGroup);
-        MyAudio.playToneAsync(600, 50); 
+        MyBus.publishPayload(BUS_AUDIO, AUDIO_TONE, AudioTone{600, 50});
     }
 }
 
+// 二维码由 MyQRCache 在后台预先生成，这里只切换图片源
 void AppUILogic::showQRCode() {
-    String content = "IMEI:865432123456789"; 
-    const char* data = content.c_str();
-    Serial.printf("[UI] Showing QR: %s\n", data);
-
-    if (_qrObj == NULL && ui_PanelQR) {
-        _qrObj = lv_qrcode_create(ui_PanelQR, 110, lv_color_black(), lv_color_white());
-        lv_obj_center(_qrObj);
-        if(ui_ImageQR) lv_obj_add_flag(ui_ImageQR, LV_OBJ_FLAG_HIDDEN);
-        lv_obj_set_style_border_width(_qrObj, 4, 0);
-        lv_obj_set_style_border_color(_qrObj, lv_color_white(), 0);
+    const lv_img_dsc_t* img = MyQRCache.acquire(QR_SLOT_IMEI);
+    _qrPending = (img == NULL);
+    if (ui_ImageQR == NULL) return;
+
+    if (img) {
+        lv_img_set_src(ui_ImageQR, img);
+        lv_obj_clear_flag(ui_ImageQR, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        // 还没生成好，loop() 里会再试
+        lv_obj_add_flag(ui_ImageQR, LV_OBJ_FLAG_HIDDEN);
     }
-    if(_qrObj) lv_qrcode_update(_qrObj, data, strlen(data));
 }
 
 void AppUILogic::executeLongPressStart() {
@@ -124,13 +247,13 @@ void AppUILogic::executeLongPressStart() {
         if(ui_ButtonAI) lv_obj_add_flag(ui_ButtonAI, LV_OBJ_FLAG_HIDDEN);
         if(ui_ButtonLink) lv_obj_add_flag(ui_ButtonLink, LV_OBJ_FLAG_HIDDEN);
         
-        MyAudio.startRecording();
+        MyBus.publish(BUS_AUDIO, AUDIO_REC_START);
         _isRecording = true;
 
     } else if (focusedObj == ui_ButtonLink) {
         Serial.println("[UI] LongPress: Go to QR");
-        MyAudio.playToneAsync(1000, 100);
-        if(ui_QRScreen) _ui_screen_change(&ui_QRScreen, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300, 0, &ui_QRScreen_screen_init);
+        MyBus.publishPayload(BUS_AUDIO, AUDIO_TONE, AudioTone{1000, 100});
+        MyScreens.show(SCREEN_QR, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300);
         showQRCode();
     }
 }
@@ -142,12 +265,7 @@ void AppUILogic::sendAudioToPC() {
         return;
     }
 
-    NetMessage msg;
-    msg.type = NET_EVENT_UPLOAD_AUDIO; 
-    msg.len  = 0; 
-    msg.data = NULL; 
-
-    if (xQueueSend(NetQueue_Handle, &msg, 0) == pdTRUE) {
+    if (MyBus.publish(BUS_NET, NET_UPLOAD_AUDIO)) {
         Serial.println("[UI] 已通知网络任务开始处理录音");
         updateAssistantStatus("Sending...");
     } else {
@@ -159,120 +277,147 @@ void AppUILogic::sendAudioToPC() {
 void AppUILogic::executeLongPressEnd() {
     if (_isRecording) {
         Serial.println("[UI] Released: Stop Recording");
-        MyAudio.stopRecording();
+        // 停录音要等 100ms 收尾，交给音频任务；停完它发 BUS_RECORDED，再上传
+        MyBus.publish(BUS_AUDIO, AUDIO_REC_STOP);
         _isRecording = false;
-        
-        sendAudioToPC(); 
     }
 }
 
 void AppUILogic::finishAIState() {
-    if (xSemaphoreTake(xGuiSemaphore, portMAX_DELAY) == pdTRUE) {
-        Serial.println("[UI] AI Process Finished. Restoring UI.");
-
-        if(ui_ButtonAI) {
-            lv_obj_clear_flag(ui_ButtonAI, LV_OBJ_FLAG_HIDDEN);
-            lv_obj_set_style_bg_color(ui_ButtonAI, lv_color_hex(0xF9F9F9), LV_PART_MAIN | LV_STATE_DEFAULT);
-        }
-        if(ui_ButtonLink) lv_obj_clear_flag(ui_ButtonLink, LV_OBJ_FLAG_HIDDEN);
-        
-        xSemaphoreGive(xGuiSemaphore);
-    }
+    setPending(UI_PENDING_FINISH);
 }
 
 void AppUILogic::updateAssistantStatus(const char* status) {
-    if (xSemaphoreTake(xGuiSemaphore, 100) == pdTRUE) { 
-        Serial.printf("[UI Status] %s\n", status);
-        // 如果有状态 Label，在这里更新
-        // if(ui_LabelStatus) lv_label_set_text(ui_LabelStatus, status);
-        xSemaphoreGive(xGuiSemaphore);
-    }
+    portENTER_CRITICAL(&_textMux);
+    copyUtf8(_statusText, sizeof(_statusText), status ? status : "");
+    portEXIT_CRITICAL(&_textMux);
+    setPending(UI_PENDING_STATUS);
 }
 
 void AppUILogic::showReplyText(const char* text) {
-    if (xSemaphoreTake(xGuiSemaphore, 100) == pdTRUE) {
-        Serial.printf("[UI Reply] %s\n", text);
-        // 如果有回复显示区域，在这里更新
-        // if(ui_LabelReply) lv_label_set_text(ui_LabelReply, text);
-        xSemaphoreGive(xGuiSemaphore);
-    }
+    portENTER_CRITICAL(&_textMux);
+    copyUtf8(_replyText, sizeof(_replyText), text);
+    portEXIT_CRITICAL(&_textMux);
+    setPending(UI_PENDING_REPLY);
 }
 
-// 注意这里是 AppUILogic
+// 切到回复页并显示最新一条回复 (录音中不打断；没有中文字体时只打印到串口)
+void AppUILogic::showReplyScreen() {
+    static char text[REPLY_TEXT_MAX];
+    portENTER_CRITICAL(&_textMux);
+    memcpy(text, _replyText, sizeof(text));
+    portEXIT_CRITICAL(&_textMux);
+    Serial.printf("[UI Reply] %s\n", text);
+
+    if (_isRecording || !AppReplyView::canDraw(text)) return;
+    MyScreens.show(SCREEN_REPLY, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300);
+    MyReplyView.setText(text);
+}
+
+void AppUILogic::returnToMain() {
+    if (MyScreens.show(SCREEN_MAIN, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300)) bindMainScreen();
+}
+
+// 组装状态栏快照，由 MyStatusBar 负责只刷新变化的部分
 void AppUILogic::updateStatusBar() {
-    if (xSemaphoreTake(xGuiSemaphore, 0) == pdTRUE) {
-        if (lv_scr_act() == ui_MainScreen && ui_MainScreen != NULL) {
-            
-            // 使用缓存的 _cachedCSQ
-            int signalPercent = 0;
-            if (_cachedCSQ > 0 && _cachedCSQ != 99) {
-                signalPercent = map(_cachedCSQ, 0, 31, 0, 100);
-                if (signalPercent > 100) signalPercent = 100;
-            }
-            
-            if (ui_Bar4gsignal) {
-                lv_bar_set_value(ui_Bar4gsignal, signalPercent, LV_ANIM_ON);
-            }
+    if (lv_scr_act() != ui_MainScreen || ui_MainScreen == NULL) return;
 
-            // 更新时间
-            if (ui_LabelTime) {
-                struct tm timeinfo;
-                if (getLocalTime(&timeinfo, 0)) { 
-                    char timeStr[10];
-                    sprintf(timeStr, "%02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
-                    lv_label_set_text(ui_LabelTime, timeStr);
-                }
-            }
-        }
-        xSemaphoreGive(xGuiSemaphore);
+    StatusBarState state;
+
+    // 使用缓存的 _cachedCSQ
+    state.signalPercent = 0;
+    if (_cachedCSQ > 0 && _cachedCSQ != 99) {
+        int percent = map(_cachedCSQ, 0, 31, 0, 100);
+        state.signalPercent = (percent > 100) ? 100 : percent;
+    }
+
+    state.minuteOfDay = -1;
+    struct tm timeinfo;
+    if (getLocalTime(&timeinfo, 0)) {
+        state.minuteOfDay = timeinfo.tm_hour * 60 + timeinfo.tm_min;
     }
+
+    if (MyWiFi.isConnected())  state.netType = STATUS_NET_WIFI;
+    else if (_cachedCSQ > 0)   state.netType = STATUS_NET_4G;
+    else                       state.netType = STATUS_NET_NONE;
+
+    state.temperatureDeci = (int16_t)lroundf(g_SystemTemp * 10.0f);
+
+    MyStatusBar.update(state);
 }
 
 void AppUILogic::handleInput(KeyAction action) {
     if (action == KEY_NONE) return;
 
-    if (xSemaphoreTake(xGuiSemaphore, portMAX_DELAY) == pdTRUE) {
-        
-        lv_obj_t* currentScreen = lv_scr_act();
-
-        switch (action) {
-            case KEY_SHORT_PRESS:
-                if (currentScreen == ui_MainScreen) {
-                    toggleFocus();
-                } 
-                else if (currentScreen == ui_QRScreen) {
-                    if(ui_MainScreen) _ui_screen_change(&ui_MainScreen, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300, 0, &ui_MainScreen_screen_init);
-                    if (_qrObj != NULL) {
-                        lv_obj_del(_qrObj);
-                        _qrObj = NULL;
-                    }
-                }
-                break;
+    lv_obj_t* currentScreen = lv_scr_act();
+
+    switch (action) {
+        case KEY_DOUBLE_CLICK:   // 还没有单独的功能，当作第二次短按，连按两下仍然切两次焦点
+        case KEY_SHORT_PRESS:
+            if (currentScreen == ui_MainScreen) {
+                toggleFocus();
+            } 
+            else if (currentScreen == ui_QRScreen) {
+                returnToMain();
+                _qrPending = false;
+            }
+            else if (currentScreen == ui_ReplyScreen) {
+                returnToMain();
+            }
+            break;
 
-            case KEY_LONG_PRESS_START:
-                if (currentScreen == ui_MainScreen) {
-                    executeLongPressStart();
-                }
-                break;
+        case KEY_LONG_PRESS_START:
+            if (currentScreen == ui_MainScreen) {
+                executeLongPressStart();
+            }
+            break;
 
-            case KEY_LONG_PRESS_END:
-                if (currentScreen == ui_MainScreen) {
-                    executeLongPressEnd();
-                }
-                break;
-                
-            default: break;
-        }
-        xSemaphoreGive(xGuiSemaphore);
+        case KEY_LONG_PRESS_END:
+            if (currentScreen == ui_MainScreen) {
+                executeLongPressEnd();
+            }
+            break;
+            
+        default: break;
     }
 }
 
 void AppUILogic::loop() {
     static uint32_t lastUpdate = 0;
+    static uint32_t lastReport = 0;
     if (millis() - lastUpdate > 1000) {
         lastUpdate = millis();
         if (lv_scr_act() == ui_MainScreen) {
             updateStatusBar();
         }
+        MyScreens.loop();
+    }
+
+    if (lv_scr_act() == ui_QRScreen && (_qrPending || MyQRCache.hasUpdate(QR_SLOT_IMEI))) {
+        showQRCode();
+    }
+
+    if (MyScreens.isActive(SCREEN_REPLY) && MyReplyView.shownFullyMs() > UI_REPLY_HOLD_MS) {
+        returnToMain();
+    }
+
+    // 空闲时 invalidations 应该只在分钟跳变时增加
+    if (millis() - lastReport > 60000) {
+        lastReport = millis();
+        StatusBarStats st;
+        MyStatusBar.getStats(&st);
+        Serial.printf("[StatusBar] %u updates, %u invalidations, %u px touched\n",
+                      st.updates, st.invalidations, st.touchedPx);
+        MyStatusBar.resetStats();
+
+        ScreenStats ss;
+        MyScreens.getStats(&ss);
+        if (ss.heapKnown) {
+            Serial.printf("[Screen] LVGL heap %u B (%u%%), high-water %u B, %u builds, %u unloads\n",
+                          ss.heapUsed, ss.heapUsedPct, ss.heapMaxUsed, ss.builds, ss.unloads);
+        } else {
+            Serial.printf("[Screen] LVGL heap not measurable (LV_MEM_CUSTOM), %u builds, %u unloads\n",
+                          ss.builds, ss.unloads);
+        }
     }
 }
\ No newline at end of file
@@ -11,6 +11,26 @@
 // [新增] 必须包含这个头文件，因为 KeyAction 是在这里定义的
 // 如果没有这一行，编译器就不认识 KeyAction
 #include "App_Sys.h" 
+#include <atomic>
+#include "App_Bus.h"
+#include "App_Reply_View.h"
+
+// --- 其它任务投递给 UI 任务的命令 (事件总线 BUS_UI 的 kind) ---
+// 丢了也没关系的才走总线 (信号每 2 秒重发)。状态文字、回复、AI 结束是 "只要最新的" 状态:
+// 写进缓冲、置 _pending 标志，UI 任务每轮都看一遍，总线队列满了也不会丢
+enum UICmdType : uint8_t {
+    UI_CMD_SIGNAL            // 4G 信号 CSQ
+};
+
+#define UI_STATUS_TEXT_MAX  128
+
+// _pending 的位
+#define UI_PENDING_STATUS   0x01
+#define UI_PENDING_REPLY    0x02
+#define UI_PENDING_FINISH   0x04
+
+// 回复页全部显示完之后停留多久回到主页
+#define UI_REPLY_HOLD_MS  8000
 
 class AppUILogic {
 public:
@@ -23,7 +43,8 @@ public:
     // 处理来自 AI 的指令
     void handleAICommand(String jsonString);
 
-    // 更新状态栏文字
+    // ---- 以下接口任何任务都可调用：只投递命令，不碰 LVGL，不会阻塞 ----
+    // 更新状态栏文字 (最多 UI_STATUS_TEXT_MAX - 1 字节)
     void updateAssistantStatus(const char* status);
     
     // 显示 AI 回复文字
@@ -35,6 +56,12 @@ public:
     // 被动设置信号强度
     void setSignalCSQ(int csq);
 
+    // 设备 IMEI，二维码页显示它
+    void setIMEI(const char* imei);
+
+    // 在 UI 任务里处理总线上积压的按键、命令和音频/433 通知 (两帧之间调用)
+    void processEvents();
+
 private:
     void updateStatusBar();
     void toggleFocus();
@@ -42,13 +69,29 @@ private:
     void executeLongPressEnd();
     void sendAudioToPC();
     void showQRCode();
+    void bindMainScreen();
+    void showReplyScreen();
+    void returnToMain();
+    bool postCommand(UICmdType type, int32_t param, const char* text);
+    void applyCommand(const BusEvent& evt);
+    void applyPending();
+    void setPending(uint8_t bits);
 
     lv_group_t* _uiGroup;
-    lv_obj_t* _qrObj = NULL;
+    bool _qrPending = false;   // 进入二维码页时图片还没生成好
     bool _isRecording = false;
+    bool _keyWakeOnly = false; // 当前这次按键是用来亮屏的
     
     // 缓存的信号值
     int _cachedCSQ = 0;
+
+    int _busSub = -1;
+
+    // 最新的状态文字和回复，网络任务写、UI 任务读，拷贝期间用自旋锁保护
+    char _statusText[UI_STATUS_TEXT_MAX];
+    char _replyText[REPLY_TEXT_MAX];
+    portMUX_TYPE _textMux = portMUX_INITIALIZER_UNLOCKED;
+    std::atomic<uint8_t> _pending{0};   // UI_PENDING_*
 };
 
 extern AppUILogic MyUILogic;
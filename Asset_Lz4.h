@@ -0,0 +1,68 @@
+/**
+ * @file Asset_Lz4.h
+ * @brief LZ4 块格式解码 (资源解压用)
+ * @details
+ * 只实现 LZ4 block 格式 (没有 frame 头)，压缩由 tools/asset_pack/asset_pack.py 在 PC 上完成。
+ * 本文件不能依赖 Arduino.h / LVGL (主机上的往返测试也会包含它)。
+ */
+#ifndef ASSET_LZ4_H
+#define ASSET_LZ4_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// 解压 src 到 dst，返回写入的字节数；数据损坏或 dst 不够时返回 -1
+static inline int asset_lz4_decode(const uint8_t *src, size_t srcLen, uint8_t *dst, size_t dstCap) {
+    const uint8_t *ip = src;
+    const uint8_t *ipEnd = src + srcLen;
+    uint8_t *op = dst;
+    uint8_t *opEnd = dst + dstCap;
+
+    while (ip < ipEnd) {
+        uint8_t token = *ip++;
+
+        // 1. 字面量
+        size_t litLen = token >> 4;
+        if (litLen == 15) {
+            uint8_t b;
+            do {
+                if (ip >= ipEnd) return -1;
+                b = *ip++;
+                litLen += b;
+            } while (b == 255);
+        }
+        if ((size_t)(ipEnd - ip) < litLen || (size_t)(opEnd - op) < litLen) return -1;
+        memcpy(op, ip, litLen);
+        ip += litLen;
+        op += litLen;
+
+        // 最后一个序列只有字面量
+        if (ip >= ipEnd) break;
+
+        // 2. 匹配
+        if (ipEnd - ip < 2) return -1;
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst)) return -1;
+
+        size_t matchLen = (token & 0x0F);
+        if (matchLen == 15) {
+            uint8_t b;
+            do {
+                if (ip >= ipEnd) return -1;
+                b = *ip++;
+                matchLen += b;
+            } while (b == 255);
+        }
+        matchLen += 4;
+        if ((size_t)(opEnd - op) < matchLen) return -1;
+
+        // 可能与输出重叠 (offset < matchLen)，只能逐字节拷贝
+        const uint8_t *match = op - offset;
+        while (matchLen--) *op++ = *match++;
+    }
+    return (int)(op - dst);
+}
+
+#endif
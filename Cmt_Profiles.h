@@ -0,0 +1,89 @@
+/**
+ * @file Cmt_Profiles.h
+ * @brief CMT2300A 寄存器配置档: RFPDK 导出的基础表 + 各档相对基础表的差异
+ * @details
+ * CMT2300A_S_Data 是 RFPDK 导出的完整配置 (地址 0x00~0x5F)，上电写一遍。
+ * 其它档 (低速远距离、高速等) 只存和基础表不同的 (地址, 值) 对，
+ * 切换时 cmtProfileSwitch 算出 "当前档 -> 目标档" 真正要改的寄存器，通常只有数据率、
+ * 频偏和接收带宽那十几个。
+ * 目前只带基础档: 远距离、高速档必须是 RFPDK 按同一工程导出的寄存器，手写的差异不可信，
+ * 仓库里还没有这些导出文件。加新档: 在 RFPDK 里改好参数导出，用 tools/cmt_profile_diff
+ * 生成差异数组，连同导出时的数据率一起加进 kCmtProfiles。收发双方必须用同一档。
+ * 不依赖 Arduino，主机工具也能用。
+ */
+#ifndef CMT_PROFILES_H
+#define CMT_PROFILES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// CMT2300A_S_Data 的数据率，换基础表时同步修改。还没有和导出这张表的 RFPDK 工程核对过，
+// App433 发送时会用 TX_DONE 实测，差得多就按实测值算 ACK 超时 (见 App_433.h)
+#define CMT_BASE_BITRATE_BPS   9600
+#define CMT_PROFILE_MAX_WRITES 96       // 整张配置表
+
+static const uint8_t CMT2300A_S_Data[] = {
+    0x00, 0x00, 0x01, 0x66, 0x02, 0xEC, 0x03, 0x1D, 0x04, 0xF0, 0x05, 0x80, 
+    0x06, 0x14, 0x07, 0x08, 0x08, 0x91, 0x09, 0x02, 0x0A, 0x02, 0x0B, 0xD0,
+    0x0C, 0xAE, 0x0D, 0xE0, 0x0E, 0x35, 0x0F, 0x00, 0x10, 0x00, 0x11, 0xF4, 
+    0x12, 0x10, 0x13, 0xE2, 0x14, 0x42, 0x15, 0x20, 0x16, 0x00, 0x17, 0x81,
+    0x18, 0x42, 0x19, 0xF3, 0x1A, 0xED, 0x1B, 0x1C, 0x1C, 0x42, 0x1D, 0xDD, 
+    0x1E, 0x3B, 0x1F, 0x1C,
+    0x20, 0xD3, 0x21, 0x64, 0x22, 0x10, 0x23, 0x33, 0x24, 0xD1, 0x25, 0x35, 
+    0x26, 0x0D, 0x27, 0x0A, 0x28, 0x9F, 0x29, 0x4B, 0x2A, 0x29, 0x2B, 0x28, 
+    0x2C, 0xC0, 0x2D, 0x28, 0x2E, 0x0A, 0x2F, 0x53, 0x30, 0x08, 0x31, 0x00, 
+    0x32, 0xB4, 0x33, 0x00, 0x34, 0x00, 0x35, 0x01, 0x36, 0x00, 0x37, 0x00, 
+    0x38, 0x12, 0x39, 0x08, 0x3A, 0x00, 0x3B, 0xAA, 0x3C, 0x16, 0x3D, 0x00, 
+    0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x3C, 0x42, 0x7E, 0x43, 0x3C, 
+    0x44, 0x7E, 0x45, 0x05, 0x46, 0x1F, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 
+    0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x03, 0x4D, 0xFF, 0x4E, 0xFF, 0x4F, 0x60, 
+    0x50, 0xFF, 0x51, 0x00, 0x52, 0x09, 0x53, 0x40, 0x54, 0x90,
+    0x55, 0x70, 0x56, 0xFE, 0x57, 0x06, 0x58, 0x00, 0x59, 0x0F, 0x5A, 0x70, 
+    0x5B, 0x00, 0x5C, 0x8A, 0x5D, 0x18, 0x5E, 0x3F, 0x5F, 0x6A
+};
+
+struct CmtProfile {
+    const char* name;
+    uint32_t bitrate;          // 这一档的数据率 (链路层按它算空中时间和 ACK 超时)
+    const uint8_t* diff;       // 相对 CMT2300A_S_Data 的 (地址, 值) 对
+    uint8_t diffCount;
+};
+
+// 第 0 档就是基础表本身
+static const CmtProfile kCmtProfiles[] = {
+    { "base", CMT_BASE_BITRATE_BPS, NULL, 0 },
+};
+#define CMT_PROFILE_COUNT (sizeof(kCmtProfiles) / sizeof(kCmtProfiles[0]))
+
+// 某一档下寄存器的值: 差异里有就用差异，否则用基础表；不在表里的地址返回 -1
+static inline int cmtProfileValue(const CmtProfile& p, uint8_t addr) {
+    for (uint8_t i = 0; i < p.diffCount; i++) {
+        if (p.diff[i * 2] == addr) return p.diff[i * 2 + 1];
+    }
+    for (size_t i = 0; i < sizeof(CMT2300A_S_Data) / 2; i++) {
+        if (CMT2300A_S_Data[i * 2] == addr) return CMT2300A_S_Data[i * 2 + 1];
+    }
+    return -1;
+}
+
+// 从 from 切到 to 要写的 (地址, 值) 对，返回个数 (最多 maxWrites)。
+// 两档的差异都是相对基础表的，所以只需要看两边差异里出现过的地址
+static inline size_t cmtProfileSwitch(const CmtProfile& from, const CmtProfile& to, uint8_t* pairs, size_t maxWrites) {
+    size_t n = 0;
+    const CmtProfile* sides[2] = { &from, &to };
+    for (int s = 0; s < 2; s++) {
+        for (uint8_t i = 0; i < sides[s]->diffCount; i++) {
+            uint8_t addr = sides[s]->diff[i * 2];
+            bool done = false;
+            for (size_t k = 0; k < n && !done; k++) done = pairs[k * 2] == addr;
+            int want = cmtProfileValue(to, addr);
+            if (done || want < 0 || want == cmtProfileValue(from, addr) || n >= maxWrites) continue;
+            pairs[n * 2] = addr;
+            pairs[n * 2 + 1] = (uint8_t)want;
+            n++;
+        }
+    }
+    return n;
+}
+
+#endif
@@ -14,8 +14,11 @@
 #include "App_WiFi.h"
 #include "App_4G.h"
 #include "App_IR.h"
+#include "App_AC.h"
+#include "App_IR_Library.h"
 #include "App_Server.h"
 #include "App_433.h"
+#include "App_Bus.h"
 
 // =========================================================================
 //  SERVER CONFIGURATION (修改服务器地址)
@@ -32,10 +35,6 @@
 // =========================================================================
 
 volatile float g_SystemTemp = 0.0f;
-QueueHandle_t AudioQueue_Handle = NULL;
-QueueHandle_t KeyQueue_Handle   = NULL;
-QueueHandle_t IRQueue_Handle    = NULL;
-QueueHandle_t NetQueue_Handle   = NULL;
 
 TaskHandle_t TaskUI_Handle    = NULL;
 TaskHandle_t TaskSys_Handle   = NULL;
@@ -53,57 +52,55 @@ enum NetMode {
 // 当前网络模式 (默认为 自动)
 NetMode currentNetMode = NET_MODE_AUTO;
 
-struct AudioMsg {
-    uint8_t type; 
-    int param;
-};
-
 // ================= [Core 1] TaskUI =================
+// UI 任务最长睡眠时间 (状态栏按秒刷新，留足余量)
+#define UI_MAX_SLEEP_MS  500
+
 void TaskUI_Code(void *pvParameters) {
     MyDisplay.init();
-    MyUILogic.init();
-    KeyAction keyMsg;
+    MyUILogic.init();   // 订阅按键、UI 命令等总线事件
     for(;;) {
-        lv_tick_inc(5);
-        if (xQueueReceive(KeyQueue_Handle, &keyMsg, 0) == pdTRUE) {
-            Serial.printf("[UI] Key Received: %d\n", keyMsg);
-            MyUILogic.handleInput(keyMsg);
-        }
-        MyDisplay.loop();
+        MyUILogic.processEvents();
+        uint32_t waitMs = MyDisplay.loop();
         MyUILogic.loop();
-        vTaskDelay(pdMS_TO_TICKS(5));
+
+        // 睡到下一个 LVGL 定时器到期，总线事件和 MyDisplay.wake() 都会提前唤醒
+        if (waitMs < 1) waitMs = 1;
+        if (waitMs > UI_MAX_SLEEP_MS) waitMs = UI_MAX_SLEEP_MS;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
     }
 }
 
 // ================= [Core 1] TaskSys =================
 void TaskSys_Code(void *pvParameters) {
-    MySys.init();
-    static uint32_t lastTempTime = 0;
+    MySys.init();   // 按键由中断 + 定时器处理，直接发到总线
     for(;;) {
-        KeyAction action = MySys.getKeyAction();
-        if (action != KEY_NONE) {
-            xQueueSend(KeyQueue_Handle, &action, 0);
-        }
-        if (millis() - lastTempTime > 1000) {
-            lastTempTime = millis();
-            g_SystemTemp = MySys.getTemperatureC();
-        }
+        g_SystemTemp = MySys.getTemperatureC();
         MySys.scanLoop();
-        vTaskDelay(pdMS_TO_TICKS(20));
+        MyAC.loop();    // 延迟的 NVS 写入
+        vTaskDelay(pdMS_TO_TICKS(1000));
     }
 }
 
 // ================= [Core 0] TaskAudio =================
 void TaskAudio_Code(void *pvParameters) {
+    int sub = MyBus.subscribe("Audio", BUS_BIT(BUS_AUDIO));   // 先订阅，初始化期间的请求不会丢
     MyAudio.init();
     Serial.println("[Audio] Initialized (Muted).");
-    AudioMsg msg;
+    BusEvent evt;
+    AudioTone tone;
     for(;;) {
-        if (xQueueReceive(AudioQueue_Handle, &msg, portMAX_DELAY) == pdTRUE) {
-            switch (msg.type) {
-                case 0: MyAudio.playToneAsync(800, 200); break;
-                case 1: MyAudio.startRecording(); break;
-                case 2: MyAudio.stopRecording(); break;
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (MyBus.poll(sub, evt)) {
+            switch (evt.kind) {
+                case AUDIO_TONE:
+                    if (AppBus::payload(evt, tone)) MyAudio.playToneAsync(tone.freq, tone.ms);
+                    break;
+                case AUDIO_REC_START: MyAudio.startRecording(); break;
+                case AUDIO_REC_STOP:
+                    MyAudio.stopRecording();
+                    MyBus.publish(BUS_RECORDED, 0, (int32_t)MyAudio.record_data_len);
+                    break;
             }
         }
     }
@@ -114,6 +111,7 @@ void TaskAudio_Code(void *pvParameters) {
 
 // ================= [Core 0] TaskNet (完整修复版) =================
 void TaskNet_Code(void *pvParameters) {
+    int sub = MyBus.subscribe("Net", BUS_BIT(BUS_NET));
     vTaskDelay(pdMS_TO_TICKS(1000));
     
     // 1. 初始化
@@ -126,10 +124,11 @@ void TaskNet_Code(void *pvParameters) {
     
     My4G.init();
     My4G.powerOn();
+    MyUILogic.setIMEI(My4G.getCachedIMEI());
     MyServer.init(SERVER_HOST, SERVER_PORT);
     
     WiFiClient wifiClient; 
-    NetMessage msg;
+    BusEvent msg;
     
     static uint32_t lastSignalCheck = 0;
     static uint32_t lastWiFiCheck = 0;
@@ -158,16 +157,33 @@ void TaskNet_Code(void *pvParameters) {
                 Serial.println("\n>>> 切换模式: 自动 (WiFi 优先)");
                 MyWiFi.connect("HC-2G", "aa888888");
             }
+            else if (input == "IR_DIAG=1" || input == "IR_DIAG=0") {
+                MyIRRx.setDiag(input.endsWith("1"));
+                Serial.printf(">>> 红外诊断输出: %s\n", MyIRRx.diag() ? "开" : "关");
+            }
+            else if (MyAC.handleSerial(input)) {
+                // 本机空调控制，不经过网络
+            }
+            else if (MyIRLib.handleSerial(input)) {
+                // 红外学习码库
+            }
+            else if (My433.handleSerial(input)) {
+                // 433 链路: 发命令给继电器/查询传感器
+            }
+            else if (MyBus.handleSerial(input)) {
+                // 事件总线统计
+            }
             else if (input.length() > 0) {
                 // 发送指令给 4G 模块
                 My4G.sendRawAT(input);
             }
         }
 
-        // --- 1. 处理消息队列 ---
-        // 将等待时间改为 5ms，避免阻塞太久导致串口数据丢失
-        if (xQueueReceive(NetQueue_Handle, &msg, pdMS_TO_TICKS(5)) == pdTRUE) {
-            if (msg.type == NET_EVENT_UPLOAD_AUDIO) {
+        // --- 1. 处理总线上的网络请求 ---
+        // 最多等 5ms，避免阻塞太久导致串口数据丢失
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(5));
+        while (MyBus.poll(sub, msg)) {
+            if (msg.kind == NET_UPLOAD_AUDIO) {
                 Serial.println("[Net] Upload Request Received.");
                 
                 // 判断当前是否可用 WiFi
@@ -189,7 +205,6 @@ void TaskNet_Code(void *pvParameters) {
                     }
                 }
             }
-            if (msg.data) { free(msg.data); msg.data = NULL; }
         }
 
         // --- 2. 信号查询 ---
@@ -214,19 +229,18 @@ void TaskNet_Code(void *pvParameters) {
 // ================= [Core 0] TaskIR =================
 void TaskIR_Code(void *pvParameters) {
     MyIR.init();
+    MyAC.init();
     for(;;) {
-        MyIR.loop();
-        vTaskDelay(pdMS_TO_TICKS(50));
+        MyIR.loop();   // 阻塞到有接收事件
     }
 }
 
 // ================= [Core 0] Task433 =================
 void Task433_Code(void *pvParameters) {
     vTaskDelay(pdMS_TO_TICKS(1000)); 
-    My433.init();
+    if (!My433.init()) vTaskDelete(NULL);   // SPI 起不来: 不碰芯片，RF 命令会提示未初始化
     for(;;) {
-        My433.loop();
-        vTaskDelay(pdMS_TO_TICKS(20));
+        My433.loop();   // 阻塞到 PKT_OK 中断
     }
 }
 
@@ -237,23 +251,21 @@ void setup() {
     Serial.println("\n\n>>> ESP32 Smart Panel Booting... <<<");
     Serial.printf("Server: %s:%d\n", SERVER_HOST, SERVER_PORT);
     
-    AudioQueue_Handle = xQueueCreate(5, sizeof(AudioMsg));
-    KeyQueue_Handle   = xQueueCreate(10, sizeof(KeyAction));
-    IRQueue_Handle    = xQueueCreate(5,  sizeof(IREvent));
-    NetQueue_Handle   = xQueueCreate(3, sizeof(NetMessage));
-
     // 创建任务
     xTaskCreatePinnedToCore(TaskAudio_Code, "Audio",   4096, NULL, 4, &TaskAudio_Handle, 0);
     xTaskCreatePinnedToCore(TaskNet_Code,   "Net",     8192, NULL, 1, &TaskNet_Handle,   0);
     xTaskCreatePinnedToCore(TaskIR_Code,    "IR",      4096, NULL, 1, &TaskIR_Handle,    0);
-    // [修改] 注释掉 433 任务，防止日志干扰
-    // xTaskCreatePinnedToCore(Task433_Code,   "RF433",   4096, NULL, 1, &Task433_Handle,   0);
+    xTaskCreatePinnedToCore(Task433_Code,   "RF433",   4096, NULL, 1, &Task433_Handle,   0);
     
     xTaskCreatePinnedToCore(TaskUI_Code,    "UI",      32768, NULL, 3, &TaskUI_Handle, 1);
     xTaskCreatePinnedToCore(TaskSys_Code,   "Sys",     4096, NULL, 2, &TaskSys_Handle,   1);
 
     Serial.println(">>> System Ready. <<<");
     Serial.println("Type 'NET=4G' to test 4G only, 'NET=AUTO' to reset.");
+    Serial.println("Type 'IR_DIAG=1' to dump raw IR timings (rate limited), 'IR_DIAG=0' to stop.");
+    Serial.println("Type 'IR_LEARN=name' to learn a remote key, 'IR_SEND=name' to replay, 'IR_LIST', 'IR_DEL=name'.");
+    Serial.println("Type 'AC' for AC state, 'AC=ON/OFF/T24/+1/COOL/FAN:HIGH/SWING' to control it.");
+    Serial.println("Type 'BUS' for event bus counters and dispatch latency.");
 }
 
 void loop() {
@@ -0,0 +1,196 @@
+/**
+ * @file Ir_Protocol.h
+ * @brief 红外协议的编译期描述与编码 (固件和主机测试共用，不依赖 Arduino)
+ * @details
+ * 一个协议就是 IrProtocol<...> 的一个特化: 引导码、bit 的 mark/space、结束 mark、
+ * 帧间隔、位序、整帧重复次数、是否每个字节后跟反码。时序都是编译期常量，
+ * 编码循环里没有查表和分支以外的开销。
+ * encode() 把负载字节变成 (mark, space) 序列交给 sink，固件里 sink 写 RMT item，
+ * 主机测试里 sink 记录时长。
+ * decode() 反过来按同一组常量 (带容差) 把接收到的时长序列还原成负载。
+ * QD-HS6324 的帧内容 (模式/温度/风速) 与 ai_server.py 的 generate_ir_code 一致，
+ * 由 tools/ir_proto_test 对照 Python 的输出做测试。
+ */
+#ifndef IR_PROTOCOL_H
+#define IR_PROTOCOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+template <uint16_t HdrMark, uint16_t HdrSpace,
+          uint16_t BitMark, uint16_t OneSpace, uint16_t ZeroSpace,
+          uint16_t FooterMark, uint32_t GapUs,
+          bool MsbFirst, uint8_t Repeats, bool InvertedPairs,
+          uint32_t CarrierHz = 38000>
+struct IrProtocol {
+    static constexpr uint16_t kHdrMark = HdrMark;
+    static constexpr uint16_t kHdrSpace = HdrSpace;
+    static constexpr uint16_t kBitMark = BitMark;
+    static constexpr uint16_t kOneSpace = OneSpace;
+    static constexpr uint16_t kZeroSpace = ZeroSpace;
+    static constexpr uint16_t kFooterMark = FooterMark;
+    static constexpr uint32_t kGapUs = GapUs;
+    static constexpr bool kMsbFirst = MsbFirst;
+    static constexpr uint8_t kRepeats = Repeats;           // 整帧发送次数
+    static constexpr bool kInvertedPairs = InvertedPairs;  // 每个负载字节后跟反码
+    static constexpr uint32_t kCarrierHz = CarrierHz;
+
+    // RMT 的单个时长字段只有 15 位
+    static_assert(HdrMark < 32768 && HdrSpace < 32768 && OneSpace < 32768, "duration exceeds RMT range");
+    static_assert(Repeats >= 1, "a frame is sent at least once");
+
+    // 负载 n 字节对应的帧字节数 / (mark, space) 对数 / 单帧时长 (不含帧间隔)
+    static constexpr size_t frameBytes(size_t n) { return InvertedPairs ? n * 2 : n; }
+    static constexpr size_t symbolCount(size_t n) { return 2 + frameBytes(n) * 8; }
+    static constexpr uint32_t maxFrameUs(size_t n) {
+        return HdrMark + HdrSpace + frameBytes(n) * 8 * (uint32_t)(BitMark + (OneSpace > ZeroSpace ? OneSpace : ZeroSpace)) + FooterMark;
+    }
+
+    // 负载 -> 帧字节 (按规则插入反码)，返回帧字节数
+    static size_t buildFrame(const uint8_t* payload, size_t n, uint8_t* frame) {
+        size_t k = 0;
+        for (size_t i = 0; i < n; i++) {
+            frame[k++] = payload[i];
+            if (InvertedPairs) frame[k++] = (uint8_t)~payload[i];
+        }
+        return k;
+    }
+
+    // 帧字节 -> 反码规则校验后的负载，不符合规则返回 0
+    static size_t parseFrame(const uint8_t* frame, size_t len, uint8_t* payload) {
+        if (!InvertedPairs) {
+            for (size_t i = 0; i < len; i++) payload[i] = frame[i];
+            return len;
+        }
+        if (len == 0 || len % 2 != 0) return 0;
+        for (size_t i = 0; i < len; i += 2) {
+            if ((uint8_t)~frame[i] != frame[i + 1]) return 0;
+            payload[i / 2] = frame[i];
+        }
+        return len / 2;
+    }
+
+    // 帧字节 -> sink(mark, space)，结束 mark 的 space 为 0。返回符号数
+    template <class Sink>
+    static size_t encodeFrame(const uint8_t* frame, size_t len, Sink& sink) {
+        sink(HdrMark, HdrSpace);
+        for (size_t i = 0; i < len; i++) {
+            for (int b = 0; b < 8; b++) {
+                int bit = MsbFirst ? 7 - b : b;
+                sink(BitMark, ((frame[i] >> bit) & 1) ? OneSpace : ZeroSpace);
+            }
+        }
+        sink(FooterMark, (uint16_t)0);
+        return 2 + len * 8;
+    }
+
+    // 负载 -> sink，frame 是调用方提供的 frameBytes(n) 字节暂存区
+    template <class Sink>
+    static size_t encode(const uint8_t* payload, size_t n, uint8_t* frame, Sink& sink) {
+        return encodeFrame(frame, buildFrame(payload, n, frame), sink);
+    }
+
+    // 实测时长与标称值的容差: 25% + 100us (接收头会把 mark 展宽)
+    static constexpr bool matches(uint32_t measured, uint32_t nominal) {
+        return measured + nominal / 4 + 100 >= nominal && measured <= nominal + nominal / 4 + 100;
+    }
+
+    // 收到的 (mark, space) 序列 -> 帧字节。src.mark(i) / src.space(i) 是第 i 个符号，
+    // space 为 0 或远长于 bit space (帧间隔/空闲) 的符号是结束 mark，重复帧只解第一帧。
+    // 返回帧字节数，时序不符或超过 maxBytes 返回 0
+    template <class Src>
+    static size_t decodeFrame(const Src& src, size_t count, uint8_t* frame, size_t maxBytes) {
+        const uint32_t longest = OneSpace > ZeroSpace ? OneSpace : ZeroSpace;
+        if (count < 3 || !matches(src.mark(0), HdrMark) || !matches(src.space(0), HdrSpace)) return 0;
+
+        size_t bits = 0;
+        for (size_t i = 1; i < count; i++) {
+            uint32_t mark = src.mark(i);
+            uint32_t space = src.space(i);
+            if (space == 0 || space > longest + longest / 2) {
+                if (!matches(mark, FooterMark) || bits == 0 || bits % 8 != 0) return 0;
+                return bits / 8;
+            }
+            if (!matches(mark, BitMark) || bits / 8 >= maxBytes) return 0;
+
+            uint8_t v;
+            if (matches(space, OneSpace)) v = 1;
+            else if (matches(space, ZeroSpace)) v = 0;
+            else return 0;
+
+            size_t byte = bits / 8, b = bits % 8;
+            if (b == 0) frame[byte] = 0;
+            frame[byte] |= (uint8_t)(v << (MsbFirst ? 7 - b : b));
+            bits++;
+        }
+        return 0;   // 没有结束 mark，帧不完整
+    }
+
+    // 收到的序列 -> 校验反码后的负载，返回负载字节数 (0 = 不是本协议)
+    template <class Src>
+    static size_t decode(const Src& src, size_t count, uint8_t* frame, size_t maxFrameBytes, uint8_t* payload) {
+        size_t len = decodeFrame(src, count, frame, maxFrameBytes);
+        return len ? parseFrame(frame, len, payload) : 0;
+    }
+};
+
+// 时序取自 IRremoteESP8266 对应协议的常量
+typedef IrProtocol<8960, 4480, 560, 1680, 560, 560, 40000, true, 1, false> IrNec;
+typedef IrProtocol<4692, 4416, 552, 1656, 552, 552, 5244, true, 2, true> IrCoolix;
+typedef IrProtocol<9166, 4470, 646, 1647, 547, 646, 100000, false, 1, false> IrElectra;
+// QD-HS6324: 引导 4350/4350，0 = 580/580，1 = 580/1580，结束 580；B2 4D + 风速 + 温度/模式，各带反码
+typedef IrProtocol<4350, 4350, 580, 1580, 580, 580, 5220, true, 1, true> IrQdhs;
+
+// ================= QD-HS6324 帧内容 =================
+enum QdhsMode : uint8_t {
+    QDHS_MODE_COOL = 0x0,
+    QDHS_MODE_DRY  = 0x4,
+    QDHS_MODE_FAN  = 0x4,   // 与 ai_server.py 的 MODE_MAP 相同，送风和除湿同码
+    QDHS_MODE_AUTO = 0x8,
+    QDHS_MODE_HEAT = 0xC
+};
+
+enum QdhsFan : uint8_t {
+    QDHS_FAN_AUTO = 0xA0,
+    QDHS_FAN_LOW  = 0xE0,
+    QDHS_FAN_MID  = 0x80,
+    QDHS_FAN_HIGH = 0x40
+};
+
+#define QDHS_TEMP_MIN        17
+#define QDHS_TEMP_MAX        30
+#define QDHS_TEMP_DEFAULT    26
+#define QDHS_PAYLOAD_BYTES   3
+#define QDHS_FRAME_BYTES     (QDHS_PAYLOAD_BYTES * 2)
+
+struct QdhsCommand {
+    QdhsMode mode;
+    uint8_t tempC;
+    QdhsFan fan;
+};
+
+// 温度编码 (格雷码式排列)，下标 = 温度 - 17
+static constexpr uint8_t kQdhsTempCode[QDHS_TEMP_MAX - QDHS_TEMP_MIN + 1] = {
+    0x0, 0x1, 0x3, 0x2, 0x6, 0x7, 0x5, 0x4, 0xC, 0xD, 0x9, 0x8, 0xA, 0xB
+};
+
+static constexpr uint8_t qdhsTempCode(uint8_t tempC) {
+    return (tempC >= QDHS_TEMP_MIN && tempC <= QDHS_TEMP_MAX) ? kQdhsTempCode[tempC - QDHS_TEMP_MIN]
+                                                               : kQdhsTempCode[QDHS_TEMP_DEFAULT - QDHS_TEMP_MIN];
+}
+
+// {模式, 温度, 风速} -> 3 字节负载 (B2, 风速, 温度<<4 | 模式)
+static inline void qdhsBuildPayload(const QdhsCommand& cmd, uint8_t payload[QDHS_PAYLOAD_BYTES]) {
+    payload[0] = 0xB2;
+    payload[1] = (uint8_t)cmd.fan;
+    payload[2] = (uint8_t)((qdhsTempCode(cmd.tempC) << 4) | (cmd.mode & 0x0F));
+}
+
+// 关机和摆风切换是固定码 (B2 7B E0 / B2 6B E0)，摆风每发一次切换一次
+static const uint8_t kQdhsOffPayload[QDHS_PAYLOAD_BYTES] = { 0xB2, 0x7B, 0xE0 };
+static const uint8_t kQdhsSwingPayload[QDHS_PAYLOAD_BYTES] = { 0xB2, 0x6B, 0xE0 };
+
+static_assert(IrQdhs::frameBytes(QDHS_PAYLOAD_BYTES) == QDHS_FRAME_BYTES, "QD-HS frame is 6 bytes");
+static_assert(qdhsTempCode(21) == 0x6 && qdhsTempCode(26) == 0xD, "temperature table");
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * @file Ir_Raw_Codec.h
+ * @brief 学习到的红外原始时长的压缩格式 (固件和主机测试共用，不依赖 Arduino)
+ * @details
+ * 遥控器的时长只有几种 (引导 mark/space、bit mark、0/1 space、帧间隔)，接收到的值
+ * 围绕它们抖动。压缩分两步:
+ *  1. 量化: 按 25% + 100us 的容差把所有时长聚成不超过 15 级，每级取平均值
+ *  2. 符号: 每个 (mark, space) 对写成一个字节 (高 4 位 mark 级号，低 4 位 space 级号)；
+ *     同一个字节连续出现时，后面的 k 个 (2..17) 写成 0xF0 | (k - 2)
+ * 格式: [版本][级数][对数 低][对数 高][级数 x 2 字节时长 (小端)][符号...]
+ * 一帧 AC 码 (约 100 对、400 字节原始数据) 一般压到 70~110 字节。
+ */
+#ifndef IR_RAW_CODEC_H
+#define IR_RAW_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define IR_RAW_VERSION      1
+#define IR_RAW_MAX_LEVELS   15          // 级号 15 留给游程字节
+#define IR_RAW_RUN_TAG      0xF0
+#define IR_RAW_RUN_MAX      17
+#define IR_RAW_HEADER_BYTES 4
+
+// 量化容差: 与 Ir_Protocol.h 的解码容差相同
+static inline uint32_t irRawLevelTop(uint32_t lo) {
+    return lo == 0 ? 0 : lo + lo / 4 + 100;
+}
+
+// 原始时长 n 对 -> out，返回字节数；级数超过 15 或 out 放不下返回 0
+static inline size_t irRawEncode(const uint16_t* marks, const uint16_t* spaces, size_t n, uint8_t* out, size_t cap) {
+    if (n == 0 || n > 0xFFFF || cap < IR_RAW_HEADER_BYTES) return 0;
+
+    // 1. 从小到大逐级找: 本级下界 = 上一级上界之后的最小时长
+    uint16_t levelLo[IR_RAW_MAX_LEVELS], level[IR_RAW_MAX_LEVELS];
+    size_t levels = 0;
+    int64_t prevTop = -1;
+    for (;;) {
+        int64_t lo = -1;
+        for (size_t i = 0; i < n * 2; i++) {
+            uint16_t d = (i & 1) ? spaces[i / 2] : marks[i / 2];
+            if ((int64_t)d > prevTop && (lo < 0 || d < lo)) lo = d;
+        }
+        if (lo < 0) break;
+        if (levels == IR_RAW_MAX_LEVELS) return 0;
+
+        uint32_t top = irRawLevelTop((uint32_t)lo);
+        uint32_t sum = 0, cnt = 0;
+        for (size_t i = 0; i < n * 2; i++) {
+            uint16_t d = (i & 1) ? spaces[i / 2] : marks[i / 2];
+            if (d >= lo && d <= top) {
+                sum += d;
+                cnt++;
+            }
+        }
+        levelLo[levels] = (uint16_t)lo;
+        level[levels] = (uint16_t)((sum + cnt / 2) / cnt);
+        levels++;
+        prevTop = top;
+    }
+
+    size_t k = 0;
+    if (cap < IR_RAW_HEADER_BYTES + levels * 2) return 0;
+    out[k++] = IR_RAW_VERSION;
+    out[k++] = (uint8_t)levels;
+    out[k++] = (uint8_t)(n & 0xFF);
+    out[k++] = (uint8_t)(n >> 8);
+    for (size_t l = 0; l < levels; l++) {
+        out[k++] = (uint8_t)(level[l] & 0xFF);
+        out[k++] = (uint8_t)(level[l] >> 8);
+    }
+
+    // 2. 符号 + 游程
+    uint8_t prev = 0;
+    size_t run = 0;
+    for (size_t i = 0; i <= n; i++) {
+        uint8_t sym = 0;
+        if (i < n) {
+            uint8_t m = 0, s = 0;
+            for (size_t l = 0; l < levels; l++) {
+                if (marks[i] >= levelLo[l] && marks[i] <= irRawLevelTop(levelLo[l])) m = (uint8_t)l;
+                if (spaces[i] >= levelLo[l] && spaces[i] <= irRawLevelTop(levelLo[l])) s = (uint8_t)l;
+            }
+            sym = (uint8_t)((m << 4) | s);
+            if (i > 0 && sym == prev && run < IR_RAW_RUN_MAX) {
+                run++;
+                continue;
+            }
+        }
+        // 结束上一段游程: 1 个重复直接再写一次符号
+        if (run == 1) {
+            if (k >= cap) return 0;
+            out[k++] = prev;
+        } else if (run >= 2) {
+            if (k >= cap) return 0;
+            out[k++] = (uint8_t)(IR_RAW_RUN_TAG | (run - 2));
+        }
+        run = 0;
+        if (i == n) break;
+        if (k >= cap) return 0;
+        out[k++] = sym;
+        prev = sym;
+    }
+    return k;
+}
+
+// 压缩数据里的 (mark, space) 对数，格式不对返回 0
+static inline size_t irRawPairs(const uint8_t* in, size_t len) {
+    if (len < IR_RAW_HEADER_BYTES || in[0] != IR_RAW_VERSION) return 0;
+    return (size_t)in[2] | ((size_t)in[3] << 8);
+}
+
+// 压缩数据 -> sink(mark, space)，最多 maxPairs 对。返回对数，格式错误返回 0
+template <class Sink>
+static size_t irRawDecode(const uint8_t* in, size_t len, Sink& sink, size_t maxPairs) {
+    size_t n = irRawPairs(in, len);
+    size_t levels = len >= 2 ? in[1] : 0;
+    if (n == 0 || n > maxPairs || levels == 0 || levels > IR_RAW_MAX_LEVELS) return 0;
+    if (len < IR_RAW_HEADER_BYTES + levels * 2) return 0;
+
+    const uint8_t* lv = in + IR_RAW_HEADER_BYTES;
+    size_t k = IR_RAW_HEADER_BYTES + levels * 2;
+    size_t done = 0;
+    uint8_t prev = 0xFF;
+    while (done < n) {
+        if (k >= len) return 0;
+        uint8_t b = in[k++];
+        size_t reps = 1;
+        if ((b & 0xF0) == IR_RAW_RUN_TAG) {
+            if (prev == 0xFF) return 0;
+            reps = (b & 0x0F) + 2;
+            b = prev;
+        }
+        uint8_t m = b >> 4, s = b & 0x0F;
+        if (m >= levels || s >= levels || done + reps > n) return 0;
+        uint16_t mark = (uint16_t)(lv[m * 2] | (lv[m * 2 + 1] << 8));
+        uint16_t space = (uint16_t)(lv[s * 2] | (lv[s * 2 + 1] << 8));
+        for (size_t r = 0; r < reps; r++) sink(mark, space);
+        done += reps;
+        prev = b;
+    }
+    return n;
+}
+
+// 名字 -> 32 位 FNV-1a，学习码库用它做 NVS 键
+static inline uint32_t irNameHash(const char* s) {
+    uint32_t h = 2166136261u;
+    while (*s) {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * @file Lockfree_Ring.h
+ * @brief 有界无锁环形队列 (多生产者 / 单消费者)
+ * @details
+ * 每个槽位带一个序号 (Vyukov 有界队列)：生产者用 CAS 抢占写位置，写完数据后
+ * 发布序号；消费者只看序号判断槽位是否就绪，不需要任何互斥锁。
+ * 满了 push 直接返回 false，不会阻塞调用方 (比如网络任务)。
+ * N 必须是 2 的幂。T 需要可平凡拷贝。本文件不依赖 Arduino.h。
+ */
+#ifndef LOCKFREE_RING_H
+#define LOCKFREE_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+template <typename T, size_t N>
+class LockfreeRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+
+public:
+    LockfreeRing() {
+        for (size_t i = 0; i < N; i++) _cells[i].seq.store(i, std::memory_order_relaxed);
+        _enqPos.store(0, std::memory_order_relaxed);
+        _deqPos = 0;
+        _dropped.store(0, std::memory_order_relaxed);
+    }
+
+    // 任意任务可调用；队列满返回 false 并计入 dropped
+    bool push(const T &item) {
+        Cell *cell;
+        size_t pos = _enqPos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & (N - 1)];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+            if (dif == 0) {
+                if (_enqPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (dif < 0) {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = _enqPos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = item;
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 只能由唯一的消费者任务调用
+    bool pop(T &out) {
+        Cell *cell = &_cells[_deqPos & (N - 1)];
+        size_t seq = cell->seq.load(std::memory_order_acquire);
+        if ((intptr_t)seq - (intptr_t)(_deqPos + 1) < 0) return false;
+        out = cell->data;
+        cell->seq.store(_deqPos + N, std::memory_order_release);
+        _deqPos++;
+        return true;
+    }
+
+    uint32_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        T data;
+    };
+
+    Cell _cells[N];
+    std::atomic<size_t> _enqPos;
+    size_t _deqPos;
+    std::atomic<uint32_t> _dropped;
+};
+
+#endif
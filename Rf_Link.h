@@ -0,0 +1,308 @@
+/**
+ * @file Rf_Link.h
+ * @brief 433MHz 链路层: 定长帧格式 + 应答重传 (固件和主机模拟器共用，不依赖 Arduino)
+ * @details
+ * 帧 (RF_FRAME_LEN = 20 字节，与 CMT2300A 的定长包一致):
+ *   [0xA5][类型<<4 | 标志][目的][源][序号][负载长度][负载 12 字节][CRC16-CCITT 大端]
+ * 需要应答的帧带 RF_FLAG_ACK_REQ，对端回同序号的 ACK，ACK 可以带负载 (传感器读数)。
+ * transact 发出后等 ACK，超时重发，超时时间按空中时间算；对端按 (源, 序号) 去重，
+ * 重发的请求不重复执行，原样补发上次的 ACK (含负载)。去重记录超过发送方的重发窗口就作废，
+ * 对端重启后序号从头开始也不会被当成重发。
+ * 无线层抽象成 RfRadio: 固件里是 App433 (CMT2300A)，tools/rf_link_sim 里是模拟的 FIFO 和中断。
+ */
+#ifndef RF_LINK_H
+#define RF_LINK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define RF_FRAME_LEN      20
+#define RF_MAGIC          0xA5
+#define RF_HDR_LEN        6
+#define RF_CRC_LEN        2
+#define RF_MAX_PAYLOAD    (RF_FRAME_LEN - RF_HDR_LEN - RF_CRC_LEN)
+#define RF_BROADCAST      0xFF
+#define RF_FLAG_ACK_REQ   0x01
+#define RF_DEDUP_SLOTS    8
+
+enum RfType : uint8_t {
+    RF_T_ACK = 0,
+    RF_T_CMD,        // 控制 (继电器开关等)
+    RF_T_POLL,       // 查询，ACK 带回读数
+    RF_T_REPORT      // 设备主动上报
+};
+
+struct RfFrame {
+    uint8_t type;
+    uint8_t flags;
+    uint8_t dst;
+    uint8_t src;
+    uint8_t seq;
+    uint8_t len;
+    uint8_t payload[RF_MAX_PAYLOAD];
+};
+
+static inline uint16_t rfCrc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int b = 0; b < 8; b++) crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+static inline void rfBuild(const RfFrame& f, uint8_t out[RF_FRAME_LEN]) {
+    memset(out, 0, RF_FRAME_LEN);
+    out[0] = RF_MAGIC;
+    out[1] = (uint8_t)((f.type << 4) | (f.flags & 0x0F));
+    out[2] = f.dst;
+    out[3] = f.src;
+    out[4] = f.seq;
+    out[5] = f.len > RF_MAX_PAYLOAD ? RF_MAX_PAYLOAD : f.len;
+    memcpy(out + RF_HDR_LEN, f.payload, out[5]);
+    uint16_t crc = rfCrc16(out, RF_FRAME_LEN - RF_CRC_LEN);
+    out[RF_FRAME_LEN - 2] = (uint8_t)(crc >> 8);
+    out[RF_FRAME_LEN - 1] = (uint8_t)crc;
+}
+
+// 校验魔数、长度和 CRC，不是链路帧返回 false
+static inline bool rfParse(const uint8_t* in, size_t len, RfFrame* f) {
+    if (len < RF_FRAME_LEN || in[0] != RF_MAGIC || in[5] > RF_MAX_PAYLOAD) return false;
+    uint16_t crc = (uint16_t)((in[RF_FRAME_LEN - 2] << 8) | in[RF_FRAME_LEN - 1]);
+    if (rfCrc16(in, RF_FRAME_LEN - RF_CRC_LEN) != crc) return false;
+    f->type = in[1] >> 4;
+    f->flags = in[1] & 0x0F;
+    f->dst = in[2];
+    f->src = in[3];
+    f->seq = in[4];
+    f->len = in[5];
+    memcpy(f->payload, in + RF_HDR_LEN, f->len);
+    return true;
+}
+
+// 无线层接口
+class RfRadio {
+public:
+    virtual ~RfRadio() {}
+    // 发一帧，阻塞到发完 (TX_DONE)，之后回到接收
+    virtual bool send(const uint8_t* frame, size_t len) = 0;
+    // 最多等 timeoutUs 收一帧 (RF_FRAME_LEN 字节)
+    virtual bool receive(uint8_t* frame, uint32_t timeoutUs) = 0;
+    // transact 等 ACK 时收到的其它帧，交还给无线层以后处理
+    virtual void defer(const uint8_t* frame) = 0;
+    virtual uint32_t nowUs() = 0;
+};
+
+struct RfLinkConfig {
+    uint32_t bitrate;        // bps，与寄存器表一致
+    uint8_t preambleBytes;
+    uint8_t syncBytes;
+    uint8_t retries;         // 首发之外最多重发几次
+    uint32_t turnaroundUs;   // 对端收到到开始回 ACK (读 FIFO、切 TX)
+};
+
+struct RfLinkStats {
+    uint32_t transactions;
+    uint32_t acked;
+    uint32_t failed;
+    uint32_t retries;
+    uint32_t duplicates;     // 对端重发、本端已处理过的请求
+    uint32_t stray;          // 迟到或不匹配的 ACK
+    uint32_t missed;         // 对端序号跳号。序号是对端全局的，对端发给别的节点的帧也算在内，
+                             // 只有对端只和本机通信 (传感器对面板) 时才等于漏收的帧数
+    uint32_t lastRttUs;
+    uint32_t minRttUs;
+    uint32_t maxRttUs;
+    uint64_t sumRttUs;
+};
+
+// 收到发给本机的新请求/上报 (已去重)；返回要放进 ACK 的负载长度
+typedef size_t (*RfRequestHandler)(const RfFrame& req, uint8_t* replyPayload, void* ctx);
+
+class RfLink {
+public:
+    RfLink(RfRadio& radio, uint8_t selfId, const RfLinkConfig& cfg) : _radio(radio), _self(selfId), _cfg(cfg) {
+        memset(&_stats, 0, sizeof(_stats));
+        memset(_seen, 0, sizeof(_seen));
+    }
+
+    void setHandler(RfRequestHandler fn, void* ctx) {
+        _handler = fn;
+        _handlerCtx = ctx;
+    }
+
+    // 换寄存器配置档后更新数据率 (空中时间、ACK 超时随之变化)
+    void setBitrate(uint32_t bps) { _cfg.bitrate = bps; }
+    uint32_t bitrate() const { return _cfg.bitrate; }
+
+    // 一帧在空中的时间 (前导 + 同步字 + 数据)
+    uint32_t airtimeUs(size_t len = RF_FRAME_LEN) const {
+        return (uint32_t)((uint64_t)(_cfg.preambleBytes + _cfg.syncBytes + len) * 8 * 1000000 / _cfg.bitrate);
+    }
+    // 等 ACK 的时间: 对端处理 + ACK 空中时间，再留一半余量
+    uint32_t ackTimeoutUs() const {
+        uint32_t t = _cfg.turnaroundUs + airtimeUs();
+        return t + t / 2;
+    }
+
+    // 发请求并等 ACK，reply 收到 ACK 帧 (可为 NULL)。重发用完仍无应答返回 false
+    bool transact(uint8_t dst, RfType type, const uint8_t* payload, size_t n, RfFrame* reply) {
+        RfFrame req;
+        fill(req, dst, type, RF_FLAG_ACK_REQ, ++_seq, payload, n);
+        uint8_t raw[RF_FRAME_LEN];
+        rfBuild(req, raw);
+        _stats.transactions++;
+
+        for (uint8_t attempt = 0; attempt <= _cfg.retries; attempt++) {
+            if (attempt > 0) _stats.retries++;
+            uint32_t t0 = _radio.nowUs();
+            if (!_radio.send(raw, RF_FRAME_LEN)) continue;
+
+            // 两端同时重发会一直撞车，超时加上按序号错开的抖动
+            uint32_t wait = ackTimeoutUs() + jitterUs(attempt);
+            uint32_t start = _radio.nowUs();
+            uint8_t in[RF_FRAME_LEN];
+            for (;;) {
+                uint32_t spent = _radio.nowUs() - start;
+                if (spent >= wait || !_radio.receive(in, wait - spent)) break;
+                RfFrame f;
+                if (rfParse(in, RF_FRAME_LEN, &f) && f.type == RF_T_ACK && f.dst == _self && f.src == dst &&
+                    f.seq == req.seq) {
+                    noteRtt(_radio.nowUs() - t0);
+                    _stats.acked++;
+                    if (reply) *reply = f;
+                    return true;
+                }
+                _radio.defer(in);
+            }
+        }
+        _stats.failed++;
+        return false;
+    }
+
+    // 不要应答的帧 (广播、上报)
+    bool sendOneWay(uint8_t dst, RfType type, const uint8_t* payload, size_t n) {
+        RfFrame f;
+        fill(f, dst, type, 0, ++_seq, payload, n);
+        uint8_t raw[RF_FRAME_LEN];
+        rfBuild(f, raw);
+        return _radio.send(raw, RF_FRAME_LEN);
+    }
+
+    // 处理收到的一帧: 不是链路帧返回 false；发给本机的请求按需回 ACK，新请求交给 handler
+    bool onReceive(const uint8_t* raw) {
+        RfFrame f;
+        if (!rfParse(raw, RF_FRAME_LEN, &f)) return false;
+        if (f.dst != _self && f.dst != RF_BROADCAST) return true;   // 别人的帧
+        if (f.type == RF_T_ACK) {
+            _stats.stray++;
+            return true;
+        }
+
+        RfFrame ack;
+        fill(ack, f.src, RF_T_ACK, 0, f.seq, NULL, 0);
+        Seen& s = track(f.src, f.seq);
+        if (s.seq == f.seq && s.acked) {
+            _stats.duplicates++;     // 上次的 ACK 丢了，补发同样的 ACK
+            ack.len = s.ackLen;
+            memcpy(ack.payload, s.ack, s.ackLen);
+        } else {
+            if (_handler) {
+                ack.len = (uint8_t)_handler(f, ack.payload, _handlerCtx);
+                if (ack.len > RF_MAX_PAYLOAD) ack.len = RF_MAX_PAYLOAD;
+            }
+            s.seq = f.seq;
+            s.acked = true;
+            s.ackLen = ack.len;
+            memcpy(s.ack, ack.payload, ack.len);
+        }
+        if ((f.flags & RF_FLAG_ACK_REQ) && f.dst == _self) {
+            uint8_t out[RF_FRAME_LEN];
+            rfBuild(ack, out);
+            _radio.send(out, RF_FRAME_LEN);
+        }
+        return true;
+    }
+
+    const RfLinkStats& stats() const { return _stats; }
+    uint8_t selfId() const { return _self; }
+
+private:
+    struct Seen {
+        bool valid;
+        bool acked;          // seq 这一帧已经处理过，ack 是回过的负载
+        uint8_t src;
+        uint8_t seq;
+        uint8_t ackLen;
+        uint8_t ack[RF_MAX_PAYLOAD];
+        uint32_t lastUs;     // 最近一次收到这个源的帧
+    };
+
+    void fill(RfFrame& f, uint8_t dst, uint8_t type, uint8_t flags, uint8_t seq, const uint8_t* payload, size_t n) {
+        f.type = type;
+        f.flags = flags;
+        f.dst = dst;
+        f.src = _self;
+        f.seq = seq;
+        f.len = (uint8_t)(n > RF_MAX_PAYLOAD ? RF_MAX_PAYLOAD : n);
+        if (payload && f.len) memcpy(f.payload, payload, f.len);
+    }
+
+    uint32_t jitterUs(uint8_t attempt) {
+        if (attempt == 0) return 0;
+        _rng = _rng * 1103515245u + 12345u + _self;
+        return (_rng >> 8) % airtimeUs();
+    }
+
+    void noteRtt(uint32_t rtt) {
+        _stats.lastRttUs = rtt;
+        if (_stats.minRttUs == 0 || rtt < _stats.minRttUs) _stats.minRttUs = rtt;
+        if (rtt > _stats.maxRttUs) _stats.maxRttUs = rtt;
+        _stats.sumRttUs += rtt;
+    }
+
+    // 发送方从首发到最后一次重发的最长时间 (每次: 发送 + 等 ACK + 最大抖动)
+    uint32_t retryWindowUs() const {
+        return (uint32_t)(_cfg.retries + 1) * (2 * airtimeUs() + ackTimeoutUs());
+    }
+
+    // 每个源记最近的序号和回过的 ACK。返回这个源的记录，seq 不同或 acked 为 false 时是新请求；
+    // 超过两倍重发窗口没来过的记录作废 (对端可能重启过，序号重新开始)
+    Seen& track(uint8_t src, uint8_t seq) {
+        uint32_t now = _radio.nowUs();
+        for (int i = 0; i < RF_DEDUP_SLOTS; i++) {
+            Seen& s = _seen[i];
+            if (!s.valid || s.src != src) continue;
+            if (now - s.lastUs > 2 * retryWindowUs()) {
+                s.acked = false;
+            } else if (s.seq != seq) {
+                uint8_t gap = (uint8_t)(seq - s.seq - 1);
+                if (gap < 64) _stats.missed += gap;    // 更大的跳变当作对端重启
+            }
+            s.lastUs = now;
+            return s;
+        }
+        Seen& s = _seen[_seenNext];
+        _seenNext = (uint8_t)((_seenNext + 1) % RF_DEDUP_SLOTS);
+        s.valid = true;
+        s.acked = false;
+        s.src = src;
+        s.seq = seq;
+        s.lastUs = now;
+        return s;
+    }
+
+    RfRadio& _radio;
+    uint8_t _self;
+    RfLinkConfig _cfg;
+    uint8_t _seq = 0;
+    uint32_t _rng = 1;
+    RfRequestHandler _handler = NULL;
+    void* _handlerCtx = NULL;
+    Seen _seen[RF_DEDUP_SLOTS];
+    uint8_t _seenNext = 0;
+    RfLinkStats _stats;
+};
+
+#endif
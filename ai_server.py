@@ -1,25 +1,36 @@
 import socket
-import dashscope
 import os
 import json
 import wave
 import io
 import struct
-import requests
 import time
 import traceback
 import re
+import sys
+import threading
+from array import array
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
-from dashscope.audio.tts import SpeechSynthesizer 
-from dashscope import Generation
-from dashscope.audio.asr import Recognition
+import math
+
+# dashscope 只有在线后端需要；全部使用 mock 后端时可以不安装 (离线基准测试)
+try:
+    import dashscope
+    from dashscope.audio.tts import SpeechSynthesizer 
+    from dashscope import Generation
+    from dashscope.audio.asr import Recognition, RecognitionCallback, RecognitionResult
+except ImportError:
+    dashscope = None
+    SpeechSynthesizer = Generation = Recognition = RecognitionResult = None
+    RecognitionCallback = object
 
 # ================= 配置区 =================
 API_KEY = "sk-f8cf143d90c248a9871c7da220dad9da"
-dashscope.api_key = API_KEY
+if dashscope: dashscope.api_key = API_KEY
 
 HOST = '0.0.0.0'
-PORT = 8080
+PORT = int(os.environ.get("SERVER_PORT", "8080"))
 
 user_home = os.path.expanduser("~")
 desktop_path = os.path.join(user_home, "Desktop")
@@ -29,6 +40,34 @@ if not os.path.exists(desktop_path):
     desktop_path = user_home
 
 RECEIVED_AUDIO_FILE = os.path.join(desktop_path, "received_audio.wav")
+# 调试用: 设为 1 时额外把上行录音存成 WAV (默认不落盘，识别走流式)
+SAVE_RECEIVED_AUDIO = os.environ.get("SAVE_RECEIVED_AUDIO", "0") == "1"
+
+# ASR 后端: dashscope (实时识别) | mock (离线测试，不访问网络)
+ASR_BACKEND = os.environ.get("ASR_BACKEND", "dashscope")
+MOCK_ASR_TEXT = os.environ.get("MOCK_ASR_TEXT", "把空调调到二十三度")
+# NLU / TTS 后端: dashscope | mock (mock 供 tools/panel_sim 离线基准使用)
+NLU_BACKEND = os.environ.get("NLU_BACKEND", "dashscope")
+TTS_BACKEND = os.environ.get("TTS_BACKEND", "dashscope")
+MOCK_NLU_DELAY = float(os.environ.get("MOCK_NLU_DELAY", "0"))
+MOCK_TTS_DELAY = float(os.environ.get("MOCK_TTS_DELAY", "0"))
+UPLOAD_CHUNK = 4096
+
+# 原生 ADPCM 扩展 (tools/adpcm_native, 与固件共用 Adpcm_Codec.h)，没编译时退回纯 Python 实现
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "tools", "adpcm_native"))
+try:
+    import adpcm_native
+except ImportError:
+    adpcm_native = None
+
+# 双声道转单声道用 audioop (C 实现)；3.13 起标准库移除了它，那时退回 array 实现
+try:
+    import warnings
+    with warnings.catch_warnings():
+        warnings.simplefilter("ignore", DeprecationWarning)
+        import audioop
+except ImportError:
+    audioop = None
 
 COLOR_GREEN = "\033[32m"
 COLOR_BLUE = "\033[34m"
@@ -108,7 +147,7 @@ class AdpcmState:
         self.valprev = 0
         self.index = 0
 
-def encode_adpcm_block(pcm_data, state):
+def py_encode_adpcm_block(pcm_data, state):
     result = bytearray()
     if len(pcm_data) % 2 != 0: pcm_data = pcm_data[:-1]
     samples = struct.unpack(f"<{len(pcm_data)//2}h", pcm_data)
@@ -175,12 +214,16 @@ def encode_adpcm_block(pcm_data, state):
             if state.index < 0: state.index = 0
             if state.index > 88: state.index = 88
             byte_val |= (delta << 4)
+        else:
+            # 奇数个采样: 高半字节填 0，解码端会按 code 0 走一步，这里同步 (与 Adpcm_Codec.h 一致)
+            state.valprev = min(32767, state.valprev + (step_size_table[state.index] >> 3))
+            state.index = max(0, state.index + index_table[0])
 
         result.append(byte_val)
     return result
 
 # ================= IMA ADPCM 解码器 (上传用) =================
-def decode_adpcm_block(adpcm_data, state):
+def py_decode_adpcm_block(adpcm_data, state):
     # adpcm_data: bytes object
     # Returns: bytes object (PCM int16)
     result = bytearray()
@@ -228,6 +271,13 @@ def decode_adpcm_block(adpcm_data, state):
         
     return result
 
+if adpcm_native is not None:
+    encode_adpcm_block = adpcm_native.encode_block
+    decode_adpcm_block = adpcm_native.decode_block
+else:
+    encode_adpcm_block = py_encode_adpcm_block
+    decode_adpcm_block = py_decode_adpcm_block
+
 # ================= 业务函数 =================
 
 def recv_all(sock, n):
@@ -240,66 +290,242 @@ def recv_all(sock, n):
         except: return None
     return data
 
-def get_ai_analysis(file_path):
-    print(f"{COLOR_BLUE}>>> [AI] 分析语音...{COLOR_RESET}")
-    file_url = str(Path(file_path).resolve())
-    
-    # 1. ASR: Speech to Text
-    text = ""
-    try:
-        messages = [
-            {
-                "role": "system",
-                "content": [{"text": ""}] 
-            },
-            {
-                "role": "user",
-                "content": [{"audio": file_url}]
-            }
-        ]
-        res = dashscope.MultiModalConversation.call(
-            model='qwen3-asr-flash',
-            api_key=API_KEY,
-            messages=messages,
-            result_format='message'
-        )
-        if res.status_code == 200:
-            content = res.output.choices[0].message.content
-            if isinstance(content, list):
-                if content and "text" in content[0]:
-                     text = content[0]["text"]
-                else: 
-                     text = str(content)
-            else:
-                text = str(content)
-            print(f"{COLOR_BLUE}>>> [ASR] 识别结果: {text}{COLOR_RESET}")
-        else:
-            print(f"ASR Failed: {res.code} - {res.message}")
-            return {"reply": "我没听清。", "command": {"has_command": False}}
-            
-    except Exception as e:
-        print(f"ASR Exception: {e}")
-        return {"reply": "我耳朵不好使了。", "command": {"has_command": False}}
+# ================= 流式 ASR =================
+
+class StreamingRecognizer:
+    """ 流式识别接口: start() -> feed(16kHz 单声道 PCM) * N -> finish() 返回最终文本
+        on_partial(text, sentence_end) 在识别出中间结果时回调 (可能在其他线程) """
+    def __init__(self, on_partial=None):
+        self.on_partial = on_partial
+
+    def start(self):
+        pass
+
+    def feed(self, pcm):
+        raise NotImplementedError
+
+    def finish(self):
+        raise NotImplementedError
+
+    def _emit(self, text, sentence_end):
+        if self.on_partial and text:
+            self.on_partial(text, sentence_end)
+
+
+class DashscopeRecognizer(StreamingRecognizer):
+    """ DashScope 实时语音识别 (边收边送) """
+    def __init__(self, on_partial=None):
+        super().__init__(on_partial)
+        self._sentences = []
+        self._done = threading.Event()
+        outer = self
+
+        class _Callback(RecognitionCallback):
+            def on_event(self, result):
+                sentence = result.get_sentence()
+                if not sentence or "text" not in sentence: return
+                end = RecognitionResult.is_sentence_end(sentence)
+                if end: outer._sentences.append(sentence["text"])
+                text = "".join(outer._sentences) if end else "".join(outer._sentences) + sentence["text"]
+                outer._emit(text, end)
+
+            def on_complete(self):
+                outer._done.set()
+
+            def on_error(self, result):
+                print(f"ASR Error: {result.message}")
+                outer._done.set()
+
+        self._rec = Recognition(model="paraformer-realtime-v2", format="pcm",
+                                sample_rate=16000, callback=_Callback())
+
+    def start(self):
+        self._rec.start()
 
-    if not text: return {"reply": "我没听见声音。", "command": {"has_command": False}}
+    def feed(self, pcm):
+        self._rec.send_audio_frame(bytes(pcm))
 
+    def finish(self):
+        self._rec.stop()
+        self._done.wait(5.0)
+        return "".join(self._sentences)
 
-    # 2. NLU: Text to Intent
+
+class MockRecognizer(StreamingRecognizer):
+    """ 离线测试用: 不做识别，按收到的音频时长逐字吐出 MOCK_ASR_TEXT """
+    def __init__(self, on_partial=None, text=None):
+        super().__init__(on_partial)
+        self._text = text if text is not None else MOCK_ASR_TEXT
+        self._samples = 0
+        self._shown = 0
+
+    def feed(self, pcm):
+        self._samples += len(pcm) // 2
+        # 每 0.2 秒音频多"识别"出一个字
+        n = min(len(self._text), self._samples // 3200)
+        if n > self._shown:
+            self._shown = n
+            self._emit(self._text[:n], n == len(self._text))
+
+    def finish(self):
+        if self._shown < len(self._text):
+            self._emit(self._text, True)
+        return self._text
+
+
+def make_recognizer(on_partial=None):
+    if ASR_BACKEND == "mock" or dashscope is None:
+        return MockRecognizer(on_partial)
+    return DashscopeRecognizer(on_partial)
+
+
+def stereo_to_mono(pcm):
+    """ 设备 I2S 是双声道交织，识别只需要单声道: 左右取平均 """
+    if audioop: return audioop.tomono(bytes(pcm), 2, 0.5, 0.5)
+    samples = array("h")
+    samples.frombytes(bytes(pcm))
+    if sys.byteorder != "little": samples.byteswap()
+    left, right = samples[0::2], samples[1::2]
+    mono = array("h", [(l + r) >> 1 for l, r in zip(left, right)])
+    if sys.byteorder != "little": mono.byteswap()
+    return mono.tobytes()
+
+
+class SpeculativeNLU:
+    """ 识别出完整句子时提前启动 NLU；最终文本一致就直接复用结果 """
+    _executor = ThreadPoolExecutor(max_workers=2)
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._text = None
+        self._future = None
+
+    def on_partial(self, text, sentence_end):
+        if not sentence_end: return
+        with self._lock:
+            if text == self._text: return
+            print(f"{COLOR_BLUE}>>> [ASR] 句子结束，提前启动 NLU: {text}{COLOR_RESET}")
+            self._text = text
+            self._future = self._executor.submit(get_nlu_result, text)
+
+    def result_for(self, text):
+        with self._lock:
+            if self._future is not None and text == self._text:
+                return self._future.result()
+        return get_nlu_result(text)
+
+
+def drain_upload(conn, remaining):
+    """ 识别中途出错时把剩下的上行读完丢掉，设备才能收到回复；读不完就关掉读方向 """
+    try:
+        while remaining > 0:
+            chunk = conn.recv(min(UPLOAD_CHUNK, remaining))
+            if not chunk: return
+            remaining -= len(chunk)
+    except OSError:
+        try: conn.shutdown(socket.SHUT_RD)
+        except OSError: pass
+
+
+def receive_and_recognize(conn, compressed_len):
+    """ 边收 ADPCM 边解码边识别，返回 (识别文本, NLU 结果) """
+    nlu = SpeculativeNLU()
+    recognizer = make_recognizer(nlu.on_partial)
+    decode_state = AdpcmState()
+    saved_pcm = bytearray() if SAVE_RECEIVED_AUDIO else None
+    received = 0
+
+    try:
+        recognizer.start()
+        while received < compressed_len:
+            chunk = conn.recv(min(UPLOAD_CHUNK, compressed_len - received))
+            if not chunk: break
+            received += len(chunk)
+            pcm = decode_adpcm_block(chunk, decode_state)
+            if saved_pcm is not None: saved_pcm.extend(pcm)
+            recognizer.feed(stereo_to_mono(pcm))
+        text = recognizer.finish()
+    except Exception as e:
+        print(f"ASR Exception: {e}")
+        drain_upload(conn, compressed_len - received)
+        return "", {"reply": "我耳朵不好使了。", "command": {"has_command": False}}
+
+    print(f"接收 ADPCM: {received}/{compressed_len} bytes")
+    if saved_pcm is not None:
+        with wave.open(RECEIVED_AUDIO_FILE, 'wb') as wav_file:
+            wav_file.setnchannels(2)
+            wav_file.setsampwidth(2)
+            wav_file.setframerate(16000)
+            wav_file.writeframes(saved_pcm)
+        print(f"调试保存: {RECEIVED_AUDIO_FILE}")
+
+    print(f"{COLOR_BLUE}>>> [ASR] 识别结果: {text}{COLOR_RESET}")
+    if not text: return "", {"reply": "我没听见声音。", "command": {"has_command": False}}
+    return text, nlu.result_for(text)
+
+
+CN_DIGITS = {"零":0,"一":1,"二":2,"两":2,"三":3,"四":4,"五":5,"六":6,"七":7,"八":8,"九":9}
+
+def parse_cn_number(text):
+    """ 识别 "23" / "二十三" / "十八" 这类温度写法，找不到返回 None """
+    m = re.search(r"(\d+)", text)
+    if m: return int(m.group(1))
+    m = re.search(r"([一二两三四五六七八九]?)十([一二三四五六七八九]?)", text)
+    if m:
+        tens = CN_DIGITS.get(m.group(1), 1) if m.group(1) else 1
+        ones = CN_DIGITS.get(m.group(2), 0) if m.group(2) else 0
+        return tens * 10 + ones
+    return None
+
+# 相对调温 / 风速的说法，设备端按 temp_delta 在当前温度上加减
+TEMP_UP_WORDS = ["高一点", "热一点", "暖一点", "调高"]
+TEMP_DOWN_WORDS = ["低一点", "凉一点", "冷一点", "调低"]
+FAN_WORDS = {"高": ["大风", "风大", "高风"], "低": ["小风", "风小", "低风"], "中": ["中风"]}
+
+def mock_nlu_result(text):
+    """ 离线 NLU: 关键词规则，输出格式与在线 NLU 相同 """
+    if MOCK_NLU_DELAY > 0: time.sleep(MOCK_NLU_DELAY)
+    m = re.search(r"遥控器?的?(.+?)[。！!？?，,]*$", text)
+    if m:
+        return {"reply": "好的，这就按。",
+                "command": {"has_command": True, "target": "遥控", "action": "发送", "ir_name": m.group(1), "params": None}}
+    if "空调" not in text:
+        return {"reply": "好的。", "command": {"has_command": False}}
+    params = {"temperature": None, "temp_delta": None, "mode": None, "fan": None}
+    t = parse_cn_number(text)
+    if t is not None and 16 <= t <= 30: params["temperature"] = t
+    elif any(w in text for w in TEMP_UP_WORDS): params["temp_delta"] = 1
+    elif any(w in text for w in TEMP_DOWN_WORDS): params["temp_delta"] = -1
+    for m in ["制冷", "制热", "送风", "除湿", "自动"]:
+        if m in text: params["mode"] = m
+    for f, words in FAN_WORDS.items():
+        if any(w in text for w in words): params["fan"] = f
+    action = "关闭" if "关" in text else ("打开" if "开" in text else "调节")
+    return {"reply": "好的，已经帮你调好空调。",
+            "command": {"has_command": True, "target": "空调", "action": action, "params": params}}
+
+def get_nlu_result(text):
+    if NLU_BACKEND == "mock": return mock_nlu_result(text)
+    # NLU: Text to Intent
     system_prompt = """
-    你是一个车载智能助手。请分析用户的文字指令，控制"空调"。
+    你是一个车载智能助手。请分析用户的文字指令，控制"空调"，或者按下用户学习过的"遥控"按键。
+    用户说 "遥控XX" (例如 "遥控电视开关") 时，target 填 "遥控"，ir_name 填 "XX" 原文，params 填 null。
     【重要】空调温度必须在 16-30 度之间。
     如果你看到文字类似 "二度" 或 "三度"（可能由语音识别错误导致），请结合语境修正为合理的数值（如 22, 23）。
     但如果用户明确说 "23度"，则必须保留 23。
+    用户只说 "高一点"、"热一点" 这类相对调整时，temperature 填 null，temp_delta 填 +1 (低一点/凉一点填 -1)。
     必须严格输出且仅输出一个合法的 JSON 对象。
     JSON 格式定义如下：
     {
         "reply": "这里是给用户的口语化回复，简短幽默，30字以内",
         "command": {
             "has_command": true/false, 
-            "target": "空调", 
+            "target": "空调" | "遥控", 
+            "ir_name": "学习时起的按键名" | null,
             "action": "打开" | "关闭" | "调节" | null, 
             "params": {
                 "temperature": 17-30 | null,
+                "temp_delta": -3..3 | null,
                 "mode": "制冷" | "制热" | "送风" | "除湿" | "自动" | null,
                 "fan": "高" | "中" | "低" | "自动" | null
             }
@@ -328,18 +554,26 @@ def get_ai_analysis(file_path):
         
     return {"reply": "我没理解你的意思。", "command": {"has_command": False}}
 
-from dashscope.audio.tts import SpeechSynthesizer 
-
-# ... (Previous Code) ...
-
-def get_tts_stream_chunk(text):
-    """ 生成器：生成 16000Hz PCM 原始数据 """
-    print(f"{COLOR_YELLOW}>>> [TTS] 生成: {text} (16kHz Stream){COLOR_RESET}")
+def mock_tts_stream(text, sample_rate=16000):
+    """ 离线 TTS: 每个字 0.2 秒的提示音，按 0.5 秒一块分段产出 """
+    if MOCK_TTS_DELAY > 0: time.sleep(MOCK_TTS_DELAY)
+    total = int(len(text) * 0.2 * sample_rate)
+    block = sample_rate // 2
+    for start in range(0, total, block):
+        n = min(block, total - start)
+        yield struct.pack(f"<{n}h", *(int(8000 * math.sin(2 * math.pi * 440 * (start + i) / sample_rate)) for i in range(n)))
+
+def get_tts_stream_chunk(text, sample_rate=16000):
+    """ 生成器：生成 sample_rate (默认 16000Hz) 单声道 PCM 原始数据 """
+    if TTS_BACKEND == "mock":
+        yield from mock_tts_stream(text, sample_rate)
+        return
+    print(f"{COLOR_YELLOW}>>> [TTS] 生成: {text} ({sample_rate // 1000}kHz Stream){COLOR_RESET}")
     try:
         result = SpeechSynthesizer.call(
             model='sambert-zhichu-v1',
             text=text,
-            sample_rate=16000,
+            sample_rate=sample_rate,
             format='pcm'
         )
         if result.get_audio_data() is not None:
@@ -347,6 +581,49 @@ def get_tts_stream_chunk(text):
     except Exception as e:
         print(f"TTS Error: {e}")
 
+# ================= 下行自适应 =================
+
+# 设备请求头 (见 App_Server.h): "PNL1" + 12 字节链路信息，之后才是 4 字节长度
+PANEL_HDR_MAGIC = b"PNL1"
+TRANSPORT_WIFI, TRANSPORT_4G = 0, 1
+ADPCM_KBPS_PER_KHZ = 4   # 4-bit 单声道: 16kHz -> 64kbps
+
+def parse_link_info(info):
+    """ 版本 2 起最后 4 字节是设备允许不限速先发的字节数 (比例由设备定)；版本 1 是播放缓冲空闲字节数 """
+    ver, transport, csq, rssi, up_kbps, down_kbps, burst = struct.unpack(">BBBbHHI", info)
+    return {"version": ver, "transport": transport, "csq": csq, "rssi": rssi,
+            "up_kbps": up_kbps, "down_kbps": down_kbps, "burst": burst if ver >= 2 else 0}
+
+def choose_downlink_rate(link):
+    """ WiFi 或实测吞吐够用 -> 16k；弱 4G / 吞吐不足 -> 8k (码率减半) """
+    if link is None or link["transport"] == TRANSPORT_WIFI: return 16000
+    need_kbps = 16 * ADPCM_KBPS_PER_KHZ * 1.5
+    if link["down_kbps"] >= need_kbps: return 16000
+    if link["down_kbps"] == 0 and link["csq"] != 99 and link["csq"] >= 20: return 16000
+    return 8000
+
+class DownlinkPacer:
+    """ 按设备播放缓冲控制发送节奏:
+        设备每秒消耗 rate/2 字节，已发送量最多领先消耗量 link["burst"] 字节。
+        开头这一段不限速，设备只在这一段里测下行吞吐；多少由设备在请求头里给 (App_Server.h)。
+        旧设备 (没有链路信息或版本 1) 保持原来的每 1KB 睡 10ms。 """
+    def __init__(self, sample_rate, link):
+        self.byte_rate = sample_rate / 2
+        self.legacy = link is None or link["burst"] == 0
+        self.budget = 0 if self.legacy else link["burst"]
+        self.start = None
+        self.sent = 0
+
+    def before_send(self, n):
+        if self.legacy:
+            time.sleep(0.01)
+            return
+        now = time.monotonic()
+        if self.start is None: self.start = now
+        ahead = self.sent + n - (now - self.start) * self.byte_rate - self.budget
+        if ahead > 0: time.sleep(ahead / self.byte_rate)
+        self.sent += n
+
 # ================= 服务端主逻辑 =================
 
 def send_hex_protocol(sock, text_data):
@@ -371,8 +648,10 @@ def start_server():
     
     print(f"\n======== [ESP32 极速流式服务端 (双向ADPCM)] ========")
     print(f"监听: {HOST}:{PORT}")
-    print(f"下行: 16kHz ADPCM Stream")
-    print(f"上行: ADPCM Upload -> Decode -> WAV")
+    print(f"下行: ADPCM Stream (16k / 弱 4G 8k 自适应)")
+    print(f"上行: ADPCM Upload -> 流式解码 -> 流式 ASR ({ASR_BACKEND})")
+    print(f"ADPCM: {'native (adpcm_native)' if adpcm_native else 'pure Python'}")
+    print(f"后端: ASR={ASR_BACKEND} NLU={NLU_BACKEND} TTS={TTS_BACKEND}")
     print(f"================================================\n")
 
     while True:
@@ -388,35 +667,27 @@ def start_server():
                 conn.close()
                 continue
             
+            # 1.0 新设备先发链路信息头
+            link = None
+            if bytes(len_data) == PANEL_HDR_MAGIC:
+                info = recv_all(conn, 12)
+                len_data = recv_all(conn, 4)
+                if not info or not len_data:
+                    conn.close()
+                    continue
+                link = parse_link_info(bytes(info))
+                print(f"链路: {'WiFi' if link['transport'] == TRANSPORT_WIFI else '4G'} CSQ={link['csq']} "
+                      f"RSSI={link['rssi']}dBm up={link['up_kbps']}kbps down={link['down_kbps']}kbps "
+                      f"burst={link['burst']}B")
+            
             compressed_len = struct.unpack('>I', len_data)[0]
-            print(f"接收 ADPCM: {compressed_len} bytes")
+            print(f"接收 ADPCM: {compressed_len} bytes (流式识别)")
             
+            # 1.1 边收边解码边识别 (不再先落盘 WAV)
             if compressed_len > 0:
-                adpcm_data = recv_all(conn, compressed_len)
-                
-                # [Upload Optimize] 解码 ADPCM -> PCM
-                decode_state = AdpcmState()
-                pcm_data = decode_adpcm_block(adpcm_data, decode_state)
-                
-                # 保存为标准 WAV (16kHz, Mono, 16bit)
-                # ESP32 采集也是单声道的 (虽然 i2s config channels=2 in setup but read 2 bytes, Adpcm uses 2 samples per byte)
-                # Correction: App_Audio uses channels=2 in i2s config but reads simply. Let's assume Mono for upload or match logic.
-                # In App_Audio: i2s config channels=2.
-                # recordTask reads 1024 bytes -> 512 samples. 
-                # If channels=2, that's 256 frames (L+R). 
-                # Adpcm encode simply takes s1, s2. So it encodes whatever comes in.
-                # If I2S is stereo, we are encoding I2S raw stream. 
-                # Decoding will produce the same I2S raw stream. 
-                # Use channels=2 for WAV header to match source.
-                
-                with wave.open(RECEIVED_AUDIO_FILE, 'wb') as wav_file:
-                    wav_file.setnchannels(2) 
-                    wav_file.setsampwidth(2)
-                    wav_file.setframerate(16000)
-                    wav_file.writeframes(pcm_data)
-                
-                print(f"解码并保存: {len(pcm_data)} bytes PCM")
-            ai_res = get_ai_analysis(RECEIVED_AUDIO_FILE)
+                _, ai_res = receive_and_recognize(conn, compressed_len)
+            else:
+                ai_res = {"reply": "我没听见声音。", "command": {"has_command": False}}
             
             # [Fix] Sanitize AI hallucinations (e.g. "2度" -> "22度")
             def sanitize_ai_result(res):
@@ -456,14 +727,18 @@ def start_server():
             cmd = ai_res.get("command", {}) 
             ir_code = generate_ir_code(cmd)
             
+            audio_rate = choose_downlink_rate(link)
             resp_json = {
                 "status": "ok", 
+                "audio_rate": audio_rate,
+                "audio_codec": "adpcm4",
                 "reply_text": reply, 
                 "control": {
                     "has_command": cmd.get("has_command", False),
                     "target": cmd.get("target"),
                     "action": cmd.get("action"),
                     "params": cmd.get("params"),
+                    "ir_name": cmd.get("ir_name"),
                     "ir_code": ir_code 
                 }
             }
@@ -474,11 +749,12 @@ def start_server():
             send_hex_protocol(conn, json_str)
             
             # 4. 发送 音频流
-            print(f"{COLOR_BLUE}>>> 开始推送 ADPCM 音频流...{COLOR_RESET}")
+            print(f"{COLOR_BLUE}>>> 开始推送 ADPCM 音频流 ({audio_rate // 1000}kHz)...{COLOR_RESET}")
             adpcm = AdpcmState()
+            pacer = DownlinkPacer(audio_rate, link)
             total_sent = 0
             
-            for pcm_chunk in get_tts_stream_chunk(reply):
+            for pcm_chunk in get_tts_stream_chunk(reply, audio_rate):
                 if not pcm_chunk: continue
                 # 编码: PCM -> ADPCM
                 encoded_chunk = encode_adpcm_block(pcm_chunk, adpcm)
@@ -489,8 +765,8 @@ def start_server():
                          CHUNK = 1024
                          for i in range(0, len(encoded_chunk), CHUNK):
                              part = encoded_chunk[i:i+CHUNK]
+                             pacer.before_send(len(part)) # 流控
                              conn.sendall(part)
-                             time.sleep(0.01) # 流控
                          total_sent += len(encoded_chunk)
                     except OSError:
                         print("连接断开")
@@ -0,0 +1,108 @@
+/**
+ * @file adpcm_native.cpp
+ * @brief ai_server.py 用的 IMA ADPCM 原生扩展 (CPython API)
+ * @details
+ * 编解码直接包含固件的 Adpcm_Codec.h，和设备端逐位一致。
+ * 接口与 ai_server.py 中的纯 Python 版本相同:
+ *   encode_block(pcm_bytes, state) -> bytes
+ *   decode_block(adpcm_bytes, state) -> bytes
+ * state 是任意带 valprev / index 属性的对象 (ai_server.AdpcmState)，调用后会被更新。
+ */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <string.h>
+
+#include "Adpcm_Codec.h"
+
+static bool load_state(PyObject *obj, AdpcmState *state) {
+    PyObject *v = PyObject_GetAttrString(obj, "valprev");
+    if (!v) return false;
+    long valprev = PyLong_AsLong(v);
+    Py_DECREF(v);
+    PyObject *i = PyObject_GetAttrString(obj, "index");
+    if (!i) return false;
+    long index = PyLong_AsLong(i);
+    Py_DECREF(i);
+    if (PyErr_Occurred()) return false;
+    if (index < 0 || index > 88) {
+        PyErr_SetString(PyExc_ValueError, "ADPCM state index out of range");
+        return false;
+    }
+    state->valprev = (int32_t)valprev;
+    state->index = (int8_t)index;
+    return true;
+}
+
+static bool store_state(PyObject *obj, const AdpcmState *state) {
+    PyObject *v = PyLong_FromLong(state->valprev);
+    PyObject *i = PyLong_FromLong(state->index);
+    bool ok = v && i &&
+              PyObject_SetAttrString(obj, "valprev", v) == 0 &&
+              PyObject_SetAttrString(obj, "index", i) == 0;
+    Py_XDECREF(v);
+    Py_XDECREF(i);
+    return ok;
+}
+
+static PyObject *encode_block(PyObject *self, PyObject *args) {
+    Py_buffer in;
+    PyObject *stateObj;
+    if (!PyArg_ParseTuple(args, "y*O", &in, &stateObj)) return NULL;
+
+    AdpcmState state;
+    if (!load_state(stateObj, &state)) { PyBuffer_Release(&in); return NULL; }
+
+    // 与 Python 版一致: 奇数字节丢弃最后一个字节；奇数个采样由 adpcm_encode_block 补 0 填充半字节
+    size_t count = (size_t)in.len / 2;
+    PyObject *out = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)((count + 1) / 2));
+    if (!out) { PyBuffer_Release(&in); return NULL; }
+
+    // PCM 是小端 int16，拷贝一次以保证对齐 (设备和 PC 都是小端)
+    int16_t *pcm = (int16_t *)PyMem_Malloc(count * sizeof(int16_t) + 1);
+    if (!pcm) { Py_DECREF(out); PyBuffer_Release(&in); return PyErr_NoMemory(); }
+    memcpy(pcm, in.buf, count * sizeof(int16_t));
+
+    Py_BEGIN_ALLOW_THREADS
+    adpcm_encode_block(pcm, count, (uint8_t *)PyBytes_AS_STRING(out), &state);
+    Py_END_ALLOW_THREADS
+
+    PyMem_Free(pcm);
+    PyBuffer_Release(&in);
+    if (!store_state(stateObj, &state)) { Py_DECREF(out); return NULL; }
+    return out;
+}
+
+static PyObject *decode_block(PyObject *self, PyObject *args) {
+    Py_buffer in;
+    PyObject *stateObj;
+    if (!PyArg_ParseTuple(args, "y*O", &in, &stateObj)) return NULL;
+
+    AdpcmState state;
+    if (!load_state(stateObj, &state)) { PyBuffer_Release(&in); return NULL; }
+
+    size_t len = (size_t)in.len;
+    PyObject *out = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)(len * 2 * sizeof(int16_t)));
+    if (!out) { PyBuffer_Release(&in); return NULL; }
+
+    Py_BEGIN_ALLOW_THREADS
+    adpcm_decode_block((const uint8_t *)in.buf, len, (int16_t *)PyBytes_AS_STRING(out), &state);
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&in);
+    if (!store_state(stateObj, &state)) { Py_DECREF(out); return NULL; }
+    return out;
+}
+
+static PyMethodDef adpcm_methods[] = {
+    {"encode_block", encode_block, METH_VARARGS, "PCM int16 LE -> IMA ADPCM (updates state)"},
+    {"decode_block", decode_block, METH_VARARGS, "IMA ADPCM -> PCM int16 LE (updates state)"},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef adpcm_module = {
+    PyModuleDef_HEAD_INIT, "adpcm_native", "Native IMA ADPCM codec shared with the panel firmware", -1, adpcm_methods
+};
+
+PyMODINIT_FUNC PyInit_adpcm_native(void) {
+    return PyModule_Create(&adpcm_module);
+}
@@ -0,0 +1,23 @@
+"""
+构建 ai_server.py 用的原生 ADPCM 扩展:
+    cd tools/adpcm_native
+    python setup.py build_ext --inplace
+编解码源码是仓库根目录下的 Adpcm_Codec.h (与固件共用)。
+"""
+import os
+from setuptools import setup, Extension
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+setup(
+    name="adpcm_native",
+    version="1.0",
+    ext_modules=[
+        Extension(
+            "adpcm_native",
+            sources=["adpcm_native.cpp"],
+            include_dirs=[ROOT],
+            extra_compile_args=["-O3"] if os.name != "nt" else ["/O2"],
+        )
+    ],
+)
@@ -0,0 +1,332 @@
+"""
+资源压缩工具: 把 SquareLine 导出的 ui_font_*.c / ui_img_*.c 改写成 LZ4 压缩数组
+    python tools/asset_pack/asset_pack.py            # 改写仓库根目录下全部字体和图片
+    python tools/asset_pack/asset_pack.py --check    # 只统计压缩率，不写文件
+    python tools/asset_pack/asset_pack.py --verify-c # 另外用 Asset_Lz4.h 在本机编译校验解压
+字体每个字形单独压缩 (按需解压单个字形)，图片整张压缩。
+运行时由 App_Asset_Cache 解压并缓存。SquareLine 重新导出后再跑一次即可，
+已经压缩过的文件会跳过。
+"""
+import argparse
+import glob
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+MARKER = "/* Packed by tools/asset_pack/asset_pack.py (LZ4) */"
+IMG_MAGIC = b"APK1"
+
+
+# ================= LZ4 块格式 =================
+
+MIN_MATCH = 4
+MF_LIMIT = 12       # 最后一个匹配必须在结尾 12 字节之前开始
+LAST_LITERALS = 5   # 最后 5 字节必须是字面量
+
+
+def _write_len(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+
+def _emit(out, literals, offset=0, match_len=0):
+    lit = len(literals)
+    ml = match_len - MIN_MATCH if match_len else 0
+    token = (min(lit, 15) << 4) | (min(ml, 15) if match_len else 0)
+    out.append(token)
+    if lit >= 15:
+        _write_len(out, lit - 15)
+    out += literals
+    if match_len:
+        out += struct.pack("<H", offset)
+        if ml >= 15:
+            _write_len(out, ml - 15)
+
+
+def lz4_compress(src):
+    src = bytes(src)
+    n = len(src)
+    out = bytearray()
+    anchor = 0
+    i = 0
+    table = {}
+    while i < n - MF_LIMIT:
+        key = src[i:i + MIN_MATCH]
+        cand = table.get(key)
+        table[key] = i
+        if cand is not None and i - cand <= 0xFFFF:
+            limit = n - LAST_LITERALS
+            m = MIN_MATCH
+            while i + m < limit and src[cand + m] == src[i + m]:
+                m += 1
+            _emit(out, src[anchor:i], i - cand, m)
+            i += m
+            anchor = i
+        else:
+            i += 1
+    _emit(out, src[anchor:])
+    return bytes(out)
+
+
+def lz4_decompress(src, raw_len):
+    out = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = src[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        out += src[i:i + lit]
+        i += lit
+        if i >= len(src):
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        ml = token & 0x0F
+        if ml == 15:
+            while True:
+                b = src[i]
+                i += 1
+                ml += b
+                if b != 255:
+                    break
+        ml += MIN_MATCH
+        start = len(out) - offset
+        for k in range(ml):
+            out.append(out[start + k])
+    if len(out) != raw_len:
+        raise ValueError("lz4 round trip: %d != %d" % (len(out), raw_len))
+    return bytes(out)
+
+
+# ================= C 源码解析 =================
+
+def strip_comments(text):
+    return re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+
+
+def array_span(text, name):
+    """返回数组 name 的 (声明起点, 内容起点, 内容终点, '};' 之后)"""
+    m = re.search(r"[^\n]*\b%s\[\]\s*=\s*\{" % re.escape(name), text)
+    if not m:
+        raise ValueError("array %s not found" % name)
+    end = text.index("};", m.end())
+    return m.start(), m.end(), end, end + 2
+
+
+def parse_ints(body):
+    return [int(t, 0) for t in re.findall(r"0x[0-9a-fA-F]+|\d+", strip_comments(body))]
+
+
+def hex_rows(data, per_row=16, indent="    "):
+    rows = []
+    for i in range(0, len(data), per_row):
+        rows.append(indent + ", ".join("0x%02x" % b for b in data[i:i + per_row]) + ",")
+    return "\n".join(rows)
+
+
+def parse_cmaps(text):
+    """返回 [(unicode, glyph_id)]"""
+    pairs = []
+    for m in re.finditer(r"\.range_start\s*=\s*(\d+),\s*\.range_length\s*=\s*(\d+),\s*\.glyph_id_start\s*=\s*(\d+),"
+                         r"\s*\.unicode_list\s*=\s*(\w+),\s*\.glyph_id_ofs_list\s*=\s*(\w+),"
+                         r"\s*\.list_length\s*=\s*(\d+),\s*\.type\s*=\s*(\w+)", text):
+        start, length, gid0 = int(m.group(1)), int(m.group(2)), int(m.group(3))
+        ulist_name, ofs_name, list_len, ctype = m.group(4), m.group(5), int(m.group(6)), m.group(7)
+
+        def arr(name):
+            _, b, e, _ = array_span(text, name)
+            return parse_ints(text[b:e])
+
+        if ctype == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+            pairs += [(start + i, gid0 + i) for i in range(length)]
+        elif ctype == "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL":
+            ofs = arr(ofs_name)
+            pairs += [(start + i, gid0 + ofs[i]) for i in range(length) if ofs[i] or i == 0]
+        elif ctype == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+            ul = arr(ulist_name)
+            pairs += [(start + ul[i], gid0 + i) for i in range(list_len)]
+        elif ctype == "LV_FONT_FMT_TXT_CMAP_SPARSE_FULL":
+            ul, ofs = arr(ulist_name), arr(ofs_name)
+            pairs += [(start + ul[i], gid0 + ofs[i]) for i in range(list_len)]
+        else:
+            raise ValueError("unsupported cmap type " + ctype)
+    return pairs
+
+
+# ================= 字体 =================
+
+def pack_font(path, text):
+    if not re.search(r"\.bitmap_format\s*=\s*0", text):
+        raise ValueError("only uncompressed (--no-compress) fonts are supported")
+    bpp = int(re.search(r"\.bpp\s*=\s*(\d+)", text).group(1))
+
+    decl, body_start, body_end, after = array_span(text, "glyph_bitmap")
+    bitmap = bytes(parse_ints(text[body_start:body_end]))
+
+    dsc = [(int(a), int(w), int(h)) for a, w, h in re.findall(
+        r"\.bitmap_index\s*=\s*(\d+),\s*\.adv_w\s*=\s*\d+,\s*\.box_w\s*=\s*(\d+),\s*\.box_h\s*=\s*(\d+)", text)]
+
+    glyphs = []
+    blob = bytearray()
+    rows = []
+    for unicode, gid in sorted(parse_cmaps(text)):
+        index, w, h = dsc[gid]
+        raw = bitmap[index:index + (w * h * bpp + 7) // 8]
+        packed = lz4_compress(raw) if raw else b""
+        if raw:
+            assert lz4_decompress(packed, len(raw)) == raw
+        glyphs.append((unicode, len(blob), len(packed), len(raw), raw, packed))
+        rows.append("    /* U+%04X */" % unicode)
+        if packed:
+            rows.append(hex_rows(packed))
+        blob += packed
+
+    # 1. 位图换成压缩数据
+    new_bitmap = text[:decl] + "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {\n" + \
+        "\n".join(rows) + "\n};" + text[after:]
+    text = new_bitmap
+
+    # 2. 字形索引表，放在 font_dsc 之前
+    table = ["/*Compressed glyphs, sorted by unicode (see App_Asset_Cache.h)*/",
+             "static const asset_glyph_t glyph_pack[] = {"]
+    for unicode, off, plen, rlen, _, _ in glyphs:
+        table.append("    {.unicode = 0x%04X, .offset = %d, .packed_len = %d, .raw_len = %d}," % (unicode, off, plen, rlen))
+    table.append("};")
+    table.append("")
+    table.append("static const asset_font_pack_t font_pack = {")
+    table.append("    .glyphs = glyph_pack,")
+    table.append("    .glyph_cnt = %d," % len(glyphs))
+    table.append("    .data = glyph_bitmap,")
+    table.append("};")
+    anchor = text.index("/*--------------------\n *  ALL CUSTOM DATA")
+    text = text[:anchor] + "\n".join(table) + "\n\n" + text[anchor:]
+
+    # 3. 字体回调与 user_data
+    text = text.replace(".get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,", ".get_glyph_bitmap = asset_font_get_bitmap,")
+    text = re.sub(r"\.user_data\s*=\s*NULL,", ".user_data = (void *)&font_pack,", text)
+    if "asset_font_get_bitmap" not in text or "&font_pack" not in text:
+        raise ValueError("font descriptor layout not recognised")
+
+    raw_total = sum(len(g[4]) for g in glyphs)
+    packed_total = len(blob) + 12 * len(glyphs)
+    return text, raw_total, packed_total, [(g[4], g[5]) for g in glyphs if g[4]]
+
+
+# ================= 图片 =================
+
+def pack_image(path, text):
+    name = re.search(r"(\w+)_data\[\]\s*=", text).group(1)
+    cf = re.search(r"\.header\.cf\s*=\s*(\w+),", text).group(1)
+    if cf == "LV_IMG_CF_USER_ENCODED_0":
+        raise ValueError("already encoded")
+
+    decl, body_start, body_end, after = array_span(text, name + "_data")
+    raw = bytes(parse_ints(text[body_start:body_end]))
+    packed = lz4_compress(raw)
+    assert lz4_decompress(packed, len(raw)) == raw
+
+    hdr = "    0x%02x, 0x%02x, 0x%02x, 0x%02x, %s, 0x00, 0x00, 0x00, %s, /* APK1, cf, raw_size */" % (
+        IMG_MAGIC[0], IMG_MAGIC[1], IMG_MAGIC[2], IMG_MAGIC[3], cf,
+        ", ".join("0x%02x" % b for b in struct.pack("<I", len(raw))))
+    body = hdr + "\n" + hex_rows(packed)
+    text = text[:decl] + "const LV_ATTRIBUTE_MEM_ALIGN uint8_t %s_data[] = {\n" % name + body + "\n};" + text[after:]
+    text = text.replace(".header.cf = %s," % cf, ".header.cf = LV_IMG_CF_USER_ENCODED_0,")
+    return text, len(raw), len(packed) + 12, [(raw, packed)]
+
+
+# ================= 主机上用固件解码器校验 =================
+
+def verify_with_c(samples):
+    cc = shutil.which("cc") or shutil.which("gcc") or shutil.which("clang")
+    if cc is None:
+        print("verify-c: no C compiler found, skipped")
+        return True
+    with tempfile.TemporaryDirectory() as tmp:
+        src = os.path.join(tmp, "check.c")
+        with open(src, "w") as f:
+            f.write('#include <stdio.h>\n#include <stdlib.h>\n#include "Asset_Lz4.h"\n'
+                    "int main(void) {\n"
+                    "    unsigned long raw_len, packed_len;\n"
+                    "    int bad = 0;\n"
+                    "    while (scanf(\"%lu %lu\", &raw_len, &packed_len) == 2) {\n"
+                    "        uint8_t *raw = malloc(raw_len + 1), *packed = malloc(packed_len + 1), *out = malloc(raw_len + 1);\n"
+                    "        for (unsigned long i = 0; i < raw_len; i++) { unsigned v; scanf(\"%x\", &v); raw[i] = v; }\n"
+                    "        for (unsigned long i = 0; i < packed_len; i++) { unsigned v; scanf(\"%x\", &v); packed[i] = v; }\n"
+                    "        int n = asset_lz4_decode(packed, packed_len, out, raw_len);\n"
+                    "        if (n != (int)raw_len || memcmp(out, raw, raw_len) != 0) bad++;\n"
+                    "        free(raw); free(packed); free(out);\n"
+                    "    }\n"
+                    "    printf(\"%d\\n\", bad);\n"
+                    "    return bad != 0;\n"
+                    "}\n")
+        exe = os.path.join(tmp, "check")
+        subprocess.run([cc, "-O2", "-I", ROOT, src, "-o", exe], check=True)
+        feed = []
+        for raw, packed in samples:
+            feed.append("%d %d %s %s" % (len(raw), len(packed), " ".join("%x" % b for b in raw),
+                                         " ".join("%x" % b for b in packed)))
+        r = subprocess.run([exe], input="\n".join(feed), capture_output=True, text=True)
+        print("verify-c: %d blocks, %s mismatches" % (len(samples), r.stdout.strip()))
+        return r.returncode == 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("files", nargs="*", help="默认: 仓库根目录下的 ui_font_*.c 和 ui_img_*.c")
+    ap.add_argument("--check", action="store_true", help="只统计，不改写文件")
+    ap.add_argument("--verify-c", action="store_true", help="用 Asset_Lz4.h 编译一个主机程序校验解压")
+    args = ap.parse_args()
+
+    files = args.files or sorted(glob.glob(os.path.join(ROOT, "ui_font_*.c")) +
+                                 glob.glob(os.path.join(ROOT, "ui_img_*.c")))
+    raw_sum = packed_sum = 0
+    samples = []
+    print("%-28s %9s %9s %7s" % ("file", "raw", "packed", "saved"))
+    for path in files:
+        with open(path, encoding="utf-8") as f:
+            text = f.read()
+        label = os.path.basename(path)
+        if MARKER in text:
+            print("%-28s already packed" % label)
+            continue
+        try:
+            if os.path.basename(path).startswith("ui_font_"):
+                new_text, raw, packed, s = pack_font(path, text)
+            else:
+                new_text, raw, packed, s = pack_image(path, text)
+        except ValueError as e:
+            print("%-28s skipped: %s" % (label, e))
+            continue
+
+        samples += s
+        raw_sum += raw
+        packed_sum += packed
+        print("%-28s %9d %9d %6.1f%%" % (label, raw, packed, 100.0 * (raw - packed) / max(raw, 1)))
+
+        if not args.check:
+            new_text = new_text.replace('#include "ui.h"\n', '#include "ui.h"\n#include "App_Asset_Cache.h"\n\n' + MARKER + "\n", 1)
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(new_text)
+
+    if raw_sum:
+        print("%-28s %9d %9d %6.1f%%" % ("total", raw_sum, packed_sum, 100.0 * (raw_sum - packed_sum) / raw_sum))
+    if args.verify_c and samples and not verify_with_c(samples):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,119 @@
+/**
+ * @file cmt_profile_diff.cpp
+ * @brief 把 RFPDK 导出的 CMT2300A 配置转成 Cmt_Profiles.h 里的差异数组
+ * @details
+ * 读入导出文件里的 (地址, 值)，支持 RFPDK 的 .exp 文本 (每行 "0x20 0xD3") 和 C 数组
+ * ("0x20, 0xD3, ...")，';' 和 '//' 之后是注释。和基础表逐个比较，输出可以直接粘贴的
+ * 差异数组和 kCmtProfiles 条目，并列出从现有各档切过去要写几个寄存器。
+ *   cmt_profile_diff <名字> <数据率 bps> <导出文件> [基础表文件]
+ * 不给基础表文件时和编进来的 CMT2300A_S_Data 比较。
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "Cmt_Profiles.h"
+
+// 按出现顺序取出所有 0xNN，两两成对；失败返回 false
+static bool loadPairs(const char* path, std::vector<uint8_t>& pairs) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    char line[512];
+    std::vector<uint8_t> bytes;
+    while (fgets(line, sizeof(line), f)) {
+        char* c = strchr(line, ';');
+        if (c) *c = '\0';
+        c = strstr(line, "//");
+        if (c) *c = '\0';
+        for (char* p = line; *p; p++) *p = (char)tolower((unsigned char)*p);
+        for (char* p = line; (p = strstr(p, "0x")) != NULL;) {
+            char* end;
+            unsigned long v = strtoul(p + 2, &end, 16);
+            if (end == p + 2 || v > 0xFF) {
+                p += 2;
+                continue;
+            }
+            bytes.push_back((uint8_t)v);
+            p = end;
+        }
+    }
+    fclose(f);
+    if (bytes.empty() || bytes.size() % 2) {
+        fprintf(stderr, "%s: expected (addr, value) pairs, got %u bytes\n", path, (unsigned)bytes.size());
+        return false;
+    }
+    pairs.swap(bytes);
+    return true;
+}
+
+static int lookup(const std::vector<uint8_t>& pairs, uint8_t addr) {
+    for (size_t i = 0; i + 1 < pairs.size(); i += 2) {
+        if (pairs[i] == addr) return pairs[i + 1];
+    }
+    return -1;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s <name> <bitrate> <export> [base]\n", argv[0]);
+        return 2;
+    }
+    const char* name = argv[1];
+    unsigned long bitrate = strtoul(argv[2], NULL, 10);
+
+    std::vector<uint8_t> target, base;
+    if (!loadPairs(argv[3], target)) return 1;
+    if (argc > 4) {
+        if (!loadPairs(argv[4], base)) return 1;
+    } else {
+        base.assign(CMT2300A_S_Data, CMT2300A_S_Data + sizeof(CMT2300A_S_Data));
+    }
+
+    std::vector<uint8_t> diff;
+    for (size_t i = 0; i < target.size(); i += 2) {
+        int was = lookup(base, target[i]);
+        if (was < 0) {
+            fprintf(stderr, "warning: 0x%02X is not in the base table, skipped\n", target[i]);
+            continue;
+        }
+        if (was != target[i + 1]) {
+            diff.push_back(target[i]);
+            diff.push_back(target[i + 1]);
+        }
+    }
+    size_t count = diff.size() / 2;
+    if (count > CMT_PROFILE_MAX_WRITES) {
+        fprintf(stderr, "diff has %u registers, more than the table\n", (unsigned)count);
+        return 1;
+    }
+
+    std::string ident = name;
+    for (size_t i = 0; i < ident.size(); i++) {
+        if (!isalnum((unsigned char)ident[i])) ident[i] = '_';
+    }
+    printf("// %s: %lu bps, %u registers differ from the base table\n", name, bitrate, (unsigned)count);
+    printf("static const uint8_t kCmtDiff_%s[] = {", ident.c_str());
+    for (size_t i = 0; i < count; i++) {
+        printf("%s0x%02X, 0x%02X,", i % 6 ? " " : "\n    ", diff[i * 2], diff[i * 2 + 1]);
+    }
+    printf("\n};\n");
+    printf("    { \"%s\", %lu, kCmtDiff_%s, %u },\n", name, bitrate, ident.c_str(), (unsigned)count);
+
+    // 从已有各档切过来的写入量 (基础表参数给的是别的文件时没有意义)
+    if (argc <= 4) {
+        CmtProfile to = { name, (uint32_t)bitrate, diff.data(), (uint8_t)count };
+        uint8_t pairs[CMT_PROFILE_MAX_WRITES * 2];
+        for (size_t i = 0; i < CMT_PROFILE_COUNT; i++) {
+            size_t n = cmtProfileSwitch(kCmtProfiles[i], to, pairs, CMT_PROFILE_MAX_WRITES);
+            fprintf(stderr, "switch %s -> %s: %u writes\n", kCmtProfiles[i].name, name, (unsigned)n);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file cmt_profile_switch_test.cpp
+ * @brief Cmt_Profiles.h 切档写入集合的主机测试
+ * @details
+ *  1. 手写的几档 (互相重叠、含与基础表相同的冗余项) 之间切换，写入集合与手算的一致
+ *  2. 任意两档之间: 在 "from" 的寄存器镜像上执行写入后与 "to" 的镜像逐个相同，没有多余写入
+ *  3. maxWrites 截断
+ *   cmt_profile_switch_test
+ */
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "Cmt_Profiles.h"
+
+static int g_failures = 0;
+
+#define CHECK(cond, ...)                                   \
+    do {                                                   \
+        if (!(cond)) {                                     \
+            g_failures++;                                  \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);    \
+            printf(__VA_ARGS__);                           \
+            printf("\n");                                  \
+        }                                                  \
+    } while (0)
+
+// 基础表里 0x20~0x24 是 D3 64 10 33 D1
+static const uint8_t kDiffA[] = { 0x20, 0x11, 0x21, 0x22 };
+static const uint8_t kDiffB[] = { 0x21, 0x44, 0x22, 0x55 };
+static const uint8_t kDiffC[] = { 0x21, 0x22, 0x23, 0x77, 0x24, 0xD1 };   // 0x21 与 A 相同，0x24 与基础表相同
+
+static const CmtProfile kBase = { "base", CMT_BASE_BITRATE_BPS, NULL, 0 };
+static const CmtProfile kA = { "A", 2400, kDiffA, 2 };
+static const CmtProfile kB = { "B", 38400, kDiffB, 2 };
+static const CmtProfile kC = { "C", 9600, kDiffC, 3 };
+
+// 写入集合与期望一致 (与顺序无关，地址不能重复)
+static void expectSwitch(const CmtProfile& from, const CmtProfile& to, const uint8_t* want, size_t wantCount) {
+    uint8_t pairs[CMT_PROFILE_MAX_WRITES * 2];
+    size_t n = cmtProfileSwitch(from, to, pairs, CMT_PROFILE_MAX_WRITES);
+    CHECK(n == wantCount, "%s -> %s: %u writes, expected %u", from.name, to.name, (unsigned)n, (unsigned)wantCount);
+    for (size_t i = 0; i < n; i++) {
+        bool found = false;
+        for (size_t k = 0; k < wantCount && !found; k++) found = want[k * 2] == pairs[i * 2] && want[k * 2 + 1] == pairs[i * 2 + 1];
+        CHECK(found, "%s -> %s: unexpected write 0x%02X = 0x%02X", from.name, to.name, pairs[i * 2], pairs[i * 2 + 1]);
+        for (size_t k = 0; k < i; k++) {
+            CHECK(pairs[k * 2] != pairs[i * 2], "%s -> %s: 0x%02X written twice", from.name, to.name, pairs[i * 2]);
+        }
+    }
+}
+
+static void image(const CmtProfile& p, uint8_t* regs) {
+    for (int a = 0; a < 0x60; a++) {
+        int v = cmtProfileValue(p, (uint8_t)a);
+        regs[a] = v < 0 ? 0 : (uint8_t)v;
+    }
+}
+
+// 在 from 的镜像上执行写入，结果要等于 to 的镜像，且每次写入都真的改了值
+static void checkApply(const CmtProfile& from, const CmtProfile& to) {
+    uint8_t regs[0x60], want[0x60];
+    uint8_t pairs[CMT_PROFILE_MAX_WRITES * 2];
+    image(from, regs);
+    image(to, want);
+    size_t n = cmtProfileSwitch(from, to, pairs, CMT_PROFILE_MAX_WRITES);
+    for (size_t i = 0; i < n; i++) {
+        CHECK(regs[pairs[i * 2]] != pairs[i * 2 + 1], "%s -> %s: redundant write 0x%02X", from.name, to.name, pairs[i * 2]);
+        regs[pairs[i * 2]] = pairs[i * 2 + 1];
+    }
+    CHECK(memcmp(regs, want, sizeof(regs)) == 0, "%s -> %s: registers differ after switch", from.name, to.name);
+}
+
+int main() {
+    CHECK(cmtProfileValue(kBase, 0x20) == 0xD3 && cmtProfileValue(kBase, 0x24) == 0xD1, "base table changed, update the test");
+    CHECK(cmtProfileValue(kA, 0x20) == 0x11 && cmtProfileValue(kA, 0x22) == 0x10, "profile value lookup");
+    CHECK(cmtProfileValue(kBase, 0x70) == -1, "address outside the table");
+
+    static const uint8_t baseToA[] = { 0x20, 0x11, 0x21, 0x22 };
+    static const uint8_t aToBase[] = { 0x20, 0xD3, 0x21, 0x64 };
+    static const uint8_t aToB[] = { 0x20, 0xD3, 0x21, 0x44, 0x22, 0x55 };
+    static const uint8_t bToA[] = { 0x20, 0x11, 0x21, 0x22, 0x22, 0x10 };
+    static const uint8_t aToC[] = { 0x20, 0xD3, 0x23, 0x77 };
+    static const uint8_t cToA[] = { 0x20, 0x11, 0x23, 0x33 };
+    static const uint8_t bToC[] = { 0x21, 0x22, 0x22, 0x10, 0x23, 0x77 };
+    static const uint8_t cToBase[] = { 0x21, 0x64, 0x23, 0x33 };   // 0x24 本来就是基础值，不写
+    expectSwitch(kBase, kA, baseToA, 2);
+    expectSwitch(kA, kBase, aToBase, 2);
+    expectSwitch(kA, kB, aToB, 3);
+    expectSwitch(kB, kA, bToA, 3);
+    expectSwitch(kA, kC, aToC, 2);
+    expectSwitch(kC, kA, cToA, 2);
+    expectSwitch(kB, kC, bToC, 3);
+    expectSwitch(kA, kA, NULL, 0);
+    expectSwitch(kC, kBase, cToBase, 2);
+
+    std::vector<const CmtProfile*> all = { &kBase, &kA, &kB, &kC };
+    for (size_t i = 0; i < CMT_PROFILE_COUNT; i++) all.push_back(&kCmtProfiles[i]);
+    for (size_t i = 0; i < all.size(); i++) {
+        for (size_t k = 0; k < all.size(); k++) checkApply(*all[i], *all[k]);
+    }
+
+    uint8_t pairs[CMT_PROFILE_MAX_WRITES * 2];
+    CHECK(cmtProfileSwitch(kA, kB, pairs, 1) == 1, "maxWrites truncates");
+
+    if (g_failures) {
+        printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
@@ -0,0 +1,34 @@
+"""
+从 ai_server.py 的 generate_ir_code 导出 QD-HS6324 测试向量，供 ir_proto_test 对照
+    python tools/ir_proto_test/gen_vectors.py     # 改了服务端编码表之后重新生成 ir_vectors.txt
+每行: 模式 温度 风速 十六进制帧 (温度超出 17~30 时服务端用默认 26 度)
+"""
+import os
+import sys
+from unittest.mock import MagicMock
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+sys.path.insert(0, ROOT)
+for mod in ("dashscope", "dashscope.audio", "dashscope.audio.tts", "requests"):
+    sys.modules.setdefault(mod, MagicMock())
+
+from ai_server import generate_ir_code, MODE_MAP, FAN_MAP  # noqa: E402
+
+OUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "ir_vectors.txt")
+
+
+def main():
+    lines = []
+    for mode in MODE_MAP:
+        for fan in FAN_MAP:
+            for temp in range(16, 32):
+                code = generate_ir_code({"has_command": True, "target": "空调", "action": "调节",
+                                         "params": {"temperature": temp, "mode": mode, "fan": fan}})
+                lines.append("%s %d %s %s" % (mode, temp, fan, code))
+    with open(OUT, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+    print("wrote %d vectors to %s" % (len(lines), OUT))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,307 @@
+/**
+ * @file ir_proto_test.cpp
+ * @brief Ir_Protocol.h 的主机测试
+ * @details
+ *  1. QD-HS6324 组帧: 对照 ai_server.py generate_ir_code 导出的向量 (ir_vectors.txt)
+ *  2. 编码时序: 与旧版 sendQDHSString 手工拼的 raw 缓冲逐项比较
+ *  3. 反码规则、NEC/Coolix/Electra 的符号数和位序
+ *  4. 解码: 带抖动的编码结果能还原负载，重复帧只取第一帧，坏时序拒绝
+ *  5. Ir_Raw_Codec.h: 学习码压缩后还原的时长在容差内，还能按协议解码
+ *   ir_proto_test [ir_vectors.txt]
+ */
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "Ir_Protocol.h"
+#include "Ir_Raw_Codec.h"
+
+static int g_failures = 0;
+
+#define CHECK(cond, ...)                                   \
+    do {                                                   \
+        if (!(cond)) {                                     \
+            g_failures++;                                  \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);    \
+            printf(__VA_ARGS__);                           \
+            printf("\n");                                  \
+        }                                                  \
+    } while (0)
+
+// 记录 (mark, space) 展开后的时长序列，结束 mark 后的 0 不记
+struct DurationSink {
+    std::vector<uint16_t> d;
+    void operator()(uint16_t mark, uint16_t space) {
+        d.push_back(mark);
+        if (space) d.push_back(space);
+    }
+};
+
+// 保留 (mark, space) 对，模拟 RMT 接收到的 item；可加抖动、在帧尾接重复帧
+struct PairSink {
+    std::vector<uint16_t> marks, spaces;
+    int jitter = 0;
+    void operator()(uint16_t mark, uint16_t space) {
+        marks.push_back((uint16_t)(mark + jitter));
+        spaces.push_back(space ? (uint16_t)(space - jitter) : 0);
+    }
+    uint16_t mark(size_t i) const { return marks[i]; }
+    uint16_t space(size_t i) const { return spaces[i]; }
+    size_t size() const { return marks.size(); }
+};
+
+static bool parseMode(const std::string& s, QdhsMode* out) {
+    if (s == "制冷") *out = QDHS_MODE_COOL;
+    else if (s == "除湿") *out = QDHS_MODE_DRY;
+    else if (s == "送风") *out = QDHS_MODE_FAN;
+    else if (s == "自动") *out = QDHS_MODE_AUTO;
+    else if (s == "制热") *out = QDHS_MODE_HEAT;
+    else return false;
+    return true;
+}
+
+static bool parseFan(const std::string& s, QdhsFan* out) {
+    if (s == "自动") *out = QDHS_FAN_AUTO;
+    else if (s == "低") *out = QDHS_FAN_LOW;
+    else if (s == "中") *out = QDHS_FAN_MID;
+    else if (s == "高") *out = QDHS_FAN_HIGH;
+    else return false;
+    return true;
+}
+
+static std::string toHex(const uint8_t* b, size_t n) {
+    std::string s;
+    char tmp[3];
+    for (size_t i = 0; i < n; i++) {
+        snprintf(tmp, sizeof(tmp), "%02X", b[i]);
+        s += tmp;
+    }
+    return s;
+}
+
+// 旧版 AppIR::sendQDHSString 的 raw 缓冲: 引导 + 每 bit (580, 580|1580) MSB 在前 + 结束 580
+static std::vector<uint16_t> legacyQdhsRaw(const uint8_t* frame, size_t len) {
+    std::vector<uint16_t> raw;
+    raw.push_back(4350);
+    raw.push_back(4350);
+    for (size_t i = 0; i < len; i++) {
+        for (int b = 7; b >= 0; b--) {
+            raw.push_back(580);
+            raw.push_back(((frame[i] >> b) & 1) ? 1580 : 580);
+        }
+    }
+    raw.push_back(580);
+    return raw;
+}
+
+static void testVectors(const char* path) {
+    FILE* f = fopen(path, "r");
+    CHECK(f != NULL, "cannot open %s", path);
+    if (f == NULL) return;
+
+    char mode[32], fan[32], hex[64];
+    int temp, count = 0;
+    while (fscanf(f, "%31s %d %31s %63s", mode, &temp, fan, hex) == 4) {
+        QdhsCommand cmd = { QDHS_MODE_COOL, 0, QDHS_FAN_AUTO };
+        CHECK(parseMode(mode, &cmd.mode), "unknown mode %s", mode);
+        CHECK(parseFan(fan, &cmd.fan), "unknown fan %s", fan);
+        cmd.tempC = (uint8_t)temp;
+
+        uint8_t payload[QDHS_PAYLOAD_BYTES];
+        uint8_t frame[QDHS_FRAME_BYTES];
+        qdhsBuildPayload(cmd, payload);
+        size_t n = IrQdhs::buildFrame(payload, QDHS_PAYLOAD_BYTES, frame);
+        std::string got = toHex(frame, n);
+        CHECK(got == hex, "%s %d %s: got %s, python %s", mode, temp, fan, got.c_str(), hex);
+
+        DurationSink sink;
+        uint8_t scratch[QDHS_FRAME_BYTES];
+        size_t symbols = IrQdhs::encode(payload, QDHS_PAYLOAD_BYTES, scratch, sink);
+        CHECK(symbols == IrQdhs::symbolCount(QDHS_PAYLOAD_BYTES), "symbol count %zu", symbols);
+        CHECK(sink.d == legacyQdhsRaw(frame, n), "%s: timing differs from legacy raw buffer", hex);
+        count++;
+    }
+    fclose(f);
+    CHECK(count > 0, "no vectors in %s", path);
+    printf("qdhs vectors: %d\n", count);
+}
+
+static void testInvertedPairs() {
+    const uint8_t good[] = { 0xB2, 0x4D, 0xA0, 0x5F, 0x60, 0x9F };
+    const uint8_t bad[] = { 0xB2, 0x4D, 0xA0, 0x5E, 0x60, 0x9F };
+    uint8_t payload[8];
+    CHECK(IrQdhs::parseFrame(good, sizeof(good), payload) == 3 && payload[2] == 0x60, "parse good frame");
+    CHECK(IrQdhs::parseFrame(bad, sizeof(bad), payload) == 0, "complement mismatch accepted");
+    CHECK(IrQdhs::parseFrame(good, 5, payload) == 0, "odd length accepted");
+
+    // Coolix: 0xB2BF20 -> B2 4D BF 40 20 DF
+    const uint8_t coolix[] = { 0xB2, 0xBF, 0x20 };
+    uint8_t frame[6];
+    CHECK(toHex(frame, IrCoolix::buildFrame(coolix, 3, frame)) == "B24DBF4020DF", "coolix frame");
+
+    // QD-HS 固定码
+    CHECK(toHex(frame, IrQdhs::buildFrame(kQdhsOffPayload, 3, frame)) == "B24D7B84E01F", "qdhs off");
+    CHECK(toHex(frame, IrQdhs::buildFrame(kQdhsSwingPayload, 3, frame)) == "B24D6B94E01F", "qdhs swing");
+}
+
+static void testBitOrder() {
+    // NEC MSB 在前: 0x80 的第一个 bit 是 1
+    const uint8_t msb[] = { 0x80 };
+    DurationSink nec;
+    uint8_t scratch[4];
+    IrNec::encode(msb, 1, scratch, nec);
+    CHECK(nec.d.size() == 2 + 16 + 1, "nec symbols %zu", nec.d.size());
+    CHECK(nec.d[3] == IrNec::kOneSpace && nec.d[5] == IrNec::kZeroSpace, "nec msb first");
+
+    // Electra LSB 在前: 0x01 的第一个 bit 是 1
+    const uint8_t lsb[] = { 0x01 };
+    DurationSink el;
+    IrElectra::encode(lsb, 1, scratch, el);
+    CHECK(el.d[3] == IrElectra::kOneSpace && el.d[5] == IrElectra::kZeroSpace, "electra lsb first");
+    CHECK(el.d[0] == 9166 && el.d[1] == 4470 && el.d.back() == 646, "electra header/footer");
+}
+
+// 编码 -> (抖动) -> 解码，负载应原样还原
+template <class P>
+static bool roundTrip(const uint8_t* payload, size_t n, int jitter, size_t repeats = 1) {
+    PairSink sink;
+    sink.jitter = jitter;
+    uint8_t frame[64], back[64];
+    for (size_t r = 0; r < repeats; r++) {
+        if (r > 0) sink.spaces.back() = (uint16_t)(P::kGapUs > 32767 ? 0 : P::kGapUs);
+        P::encode(payload, n, frame, sink);
+    }
+    size_t got = P::decode(sink, sink.size(), frame, sizeof(frame), back);
+    return got == n && memcmp(back, payload, n) == 0;
+}
+
+static void testDecode() {
+    int count = 0;
+    for (int m = 0; m < 4; m++) {
+        static const QdhsMode modes[] = { QDHS_MODE_COOL, QDHS_MODE_DRY, QDHS_MODE_AUTO, QDHS_MODE_HEAT };
+        static const QdhsFan fans[] = { QDHS_FAN_AUTO, QDHS_FAN_LOW, QDHS_FAN_MID, QDHS_FAN_HIGH };
+        for (int t = QDHS_TEMP_MIN; t <= QDHS_TEMP_MAX; t++) {
+            QdhsCommand cmd = { modes[m], (uint8_t)t, fans[t % 4] };
+            uint8_t payload[QDHS_PAYLOAD_BYTES];
+            qdhsBuildPayload(cmd, payload);
+            CHECK(roundTrip<IrQdhs>(payload, QDHS_PAYLOAD_BYTES, 0), "qdhs %s exact", toHex(payload, 3).c_str());
+            CHECK(roundTrip<IrQdhs>(payload, QDHS_PAYLOAD_BYTES, 120), "qdhs %s +120us", toHex(payload, 3).c_str());
+            CHECK(roundTrip<IrQdhs>(payload, QDHS_PAYLOAD_BYTES, -100), "qdhs %s -100us", toHex(payload, 3).c_str());
+            count++;
+        }
+    }
+
+    const uint8_t nec[] = { 0x20, 0xDF, 0x10, 0xEF };
+    CHECK(roundTrip<IrNec>(nec, 4, 100), "nec");
+    const uint8_t coolix[] = { 0xB2, 0xBF, 0x20 };
+    CHECK(roundTrip<IrCoolix>(coolix, 3, 80, 2), "coolix with repeat");
+    const uint8_t electra[13] = { 0xC3, 0x87, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x05, 0xEF };
+    CHECK(roundTrip<IrElectra>(electra, 13, 100), "electra 13 bytes");
+
+    // 坏时序: 一个 bit space 落在 0/1 之间
+    PairSink sink;
+    uint8_t frame[16], back[16];
+    IrQdhs::encode(kQdhsOffPayload, 3, frame, sink);
+    sink.spaces[5] = 1080;
+    CHECK(IrQdhs::decode(sink, sink.size(), frame, sizeof(frame), back) == 0, "ambiguous space accepted");
+
+    // 截断: 没有结束 mark
+    PairSink cut;
+    IrQdhs::encode(kQdhsOffPayload, 3, frame, cut);
+    CHECK(IrQdhs::decode(cut, cut.size() - 5, frame, sizeof(frame), back) == 0, "truncated frame accepted");
+
+    // 帧比缓冲长
+    CHECK(IrQdhs::decodeFrame(cut, cut.size(), frame, 4) == 0, "oversize frame accepted");
+
+    // NEC 负载不会被当成 QD-HS (引导码不同)
+    PairSink necSink;
+    IrNec::encode(nec, 4, frame, necSink);
+    CHECK(IrQdhs::decode(necSink, necSink.size(), frame, sizeof(frame), back) == 0, "nec decoded as qdhs");
+    printf("decode round trips: %d\n", count * 3);
+}
+
+// 模拟接收头的抖动 (固定种子，结果可复现)
+static uint32_t g_rng = 12345;
+static int jitterUs(int range) {
+    g_rng = g_rng * 1103515245u + 12345u;
+    return (int)((g_rng >> 16) % (2 * range + 1)) - range;
+}
+
+static void testRawCodec() {
+    // 一帧 QD-HS 加抖动，末尾再接一帧 (帧间隔 5220)
+    PairSink cap;
+    uint8_t frame[16], back[16];
+    IrQdhs::encode(kQdhsSwingPayload, 3, frame, cap);
+    cap.spaces.back() = IrQdhs::kGapUs;
+    IrQdhs::encode(kQdhsOffPayload, 3, frame, cap);
+    for (size_t i = 0; i < cap.size(); i++) {
+        cap.marks[i] = (uint16_t)(cap.marks[i] + jitterUs(60));
+        if (cap.spaces[i]) cap.spaces[i] = (uint16_t)(cap.spaces[i] + jitterUs(60));
+    }
+
+    uint8_t blob[512];
+    size_t len = irRawEncode(cap.marks.data(), cap.spaces.data(), cap.size(), blob, sizeof(blob));
+    CHECK(len > 0, "raw encode failed");
+    CHECK(len * 3 < cap.size() * 4, "poor compression: %zu bytes for %zu pairs", len, cap.size());
+    CHECK(blob[1] <= 6, "levels %u", blob[1]);
+    printf("raw codec: %zu pairs, %zu -> %zu bytes, %u levels\n", cap.size(), cap.size() * 4, len, blob[1]);
+
+    PairSink out;
+    CHECK(irRawDecode(blob, len, out, 1024) == cap.size(), "raw decode pair count");
+    bool close = out.size() == cap.size();
+    for (size_t i = 0; close && i < cap.size(); i++) {
+        close = IrQdhs::matches(out.marks[i], cap.marks[i]) && IrQdhs::matches(out.spaces[i], cap.spaces[i]);
+    }
+    CHECK(close, "decoded durations drift");
+    CHECK(IrQdhs::decode(out, out.size(), frame, sizeof(frame), back) == 3 &&
+          memcmp(back, kQdhsSwingPayload, 3) == 0, "decoded raw is not a QD-HS swing frame");
+
+    // 超过 15 级的噪声拒绝
+    const uint16_t noise[16] = { 100, 300, 600, 900, 1300, 1800, 2500, 3300,
+                                 4300, 5600, 7200, 9200, 11700, 14800, 18700, 23600 };
+    CHECK(irRawEncode(noise, noise, 16, blob, sizeof(blob)) == 0, "16 levels accepted");
+    CHECK(irRawEncode(noise, noise, 15, blob, sizeof(blob)) > 0, "15 levels rejected");
+
+    // 缓冲不够 / 截断 / 版本不对
+    CHECK(irRawEncode(cap.marks.data(), cap.spaces.data(), cap.size(), blob, 20) == 0, "small buffer accepted");
+    len = irRawEncode(cap.marks.data(), cap.spaces.data(), cap.size(), blob, sizeof(blob));
+    PairSink tmp;
+    CHECK(irRawDecode(blob, len - 1, tmp, 1024) == 0, "truncated blob accepted");
+    CHECK(irRawDecode(blob, len, tmp, 10) == 0, "maxPairs ignored");
+    blob[0] = 99;
+    CHECK(irRawDecode(blob, len, tmp, 1024) == 0, "bad version accepted");
+
+    // 长游程 (超过 17 个) 分段
+    std::vector<uint16_t> m(40, 560), sp(40, 560);
+    sp.back() = 0;
+    len = irRawEncode(m.data(), sp.data(), 40, blob, sizeof(blob));
+    PairSink runs;
+    CHECK(irRawDecode(blob, len, runs, 64) == 40 && runs.spaces[38] == 560 && runs.spaces[39] == 0, "long run");
+
+    CHECK(irNameHash("") == 2166136261u && irNameHash("a") == 0xE40C292Cu, "fnv-1a");
+}
+
+static void testConstexpr() {
+    static_assert(IrQdhs::symbolCount(3) == 50, "6 bytes + header + footer");
+    static_assert(IrCoolix::kRepeats == 2, "coolix sends the frame twice");
+    static_assert(IrElectra::symbolCount(13) == 106, "electra 13 byte state");
+    static_assert(IrQdhs::maxFrameUs(3) == 4350 + 4350 + 48 * (580 + 1580) + 580, "frame duration");
+    static_assert(qdhsTempCode(16) == qdhsTempCode(QDHS_TEMP_DEFAULT), "out of range -> default");
+}
+
+int main(int argc, char** argv) {
+    const char* vectors = argc > 1 ? argv[1] : "ir_vectors.txt";
+    testVectors(vectors);
+    testInvertedPairs();
+    testBitOrder();
+    testDecode();
+    testRawCodec();
+    testConstexpr();
+    if (g_failures) {
+        printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
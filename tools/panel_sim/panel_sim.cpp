@@ -0,0 +1,297 @@
+/**
+ * @file panel_sim.cpp
+ * @brief PC 端面板模拟器: 按 AppServer::chatWithServer 的线协议与 ai_server.py 对话并计时
+ * @details
+ * 协议 (WiFi 路径):
+ *   上行: [可选] "PNL1" + 12 字节链路信息 (见 App_Server.h)，
+ *         4 字节大端长度 + ADPCM 数据 (双声道交织, 16kHz)
+ *   下行: JSON 的 Hex 文本 (忽略 \r\n) + '*' + ADPCM 音频直到对端关闭
+ * 用法:
+ *   panel_sim [--host 127.0.0.1] [--port 8080] [--runs 5]
+ *             [--fixture file.adpcm | --synth-ms 3000] [--json out.json]
+ *             [--transport wifi|4g] [--csq 0-31] [--burst BYTES] [--legacy]
+ */
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Adpcm_Codec.h"
+
+using Clock = std::chrono::steady_clock;
+
+// 模拟的链路信息 (对应 AppServer::buildRequestHeader)
+struct LinkInfo {
+    bool legacy = false;   // true: 不发链路头 (旧固件)
+    uint8_t transport = 0; // 0 WiFi, 1 4G
+    uint8_t csq = 99;
+    int8_t rssi = -60;
+    uint16_t upKbps = 0;
+    uint16_t downKbps = 0;
+    uint32_t burst = 150 * 1024;  // 服务端可以不限速先发的字节数
+};
+
+struct RunResult {
+    bool ok = false;
+    double connect_ms = 0;
+    double upload_ms = 0;
+    double json_ms = 0;        // 上传完成 -> 收到 '*'
+    double first_audio_ms = 0; // 上传完成 -> 第一个音频字节
+    double total_ms = 0;       // 开始连接 -> 对端关闭
+    size_t upload_bytes = 0;
+    size_t json_bytes = 0;
+    size_t audio_bytes = 0;
+    std::string json;
+};
+
+static double ms_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+static uint8_t hex_val(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return 0;
+}
+
+// 生成一段与设备录音相同格式的 ADPCM: 双声道交织、左右相同
+static std::vector<uint8_t> synth_fixture(int ms) {
+    const int rate = 16000;
+    size_t frames = (size_t)rate * ms / 1000;
+    std::vector<int16_t> pcm(frames * 2);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < frames; i++) {
+        seed = seed * 1103515245u + 12345u;
+        double v = 6000 * std::sin(2 * M_PI * 300 * i / rate) + (int)((seed >> 16) % 800) - 400;
+        pcm[i * 2] = pcm[i * 2 + 1] = (int16_t)v;
+    }
+    std::vector<uint8_t> out((pcm.size() + 1) / 2);
+    AdpcmState st = {0, 0};
+    adpcm_encode_block(pcm.data(), pcm.size(), out.data(), &st);
+    return out;
+}
+
+static bool load_fixture(const char *path, std::vector<uint8_t> &out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+    fclose(f);
+    return true;
+}
+
+static int tcp_connect(const char *host, int port) {
+    addrinfo hints = {}, *res = nullptr;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    char portStr[8];
+    snprintf(portStr, sizeof(portStr), "%d", port);
+    if (getaddrinfo(host, portStr, &hints, &res) != 0) return -1;
+    int fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (fd >= 0 && connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    if (fd >= 0) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+static bool send_all(int fd, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = send(fd, data, len, 0);
+        if (n <= 0) return false;
+        data += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static size_t build_header(const LinkInfo &link, uint32_t len, uint8_t *buf) {
+    size_t n = 0;
+    if (!link.legacy) {
+        memcpy(buf, "PNL1", 4);
+        buf[4] = 2;
+        buf[5] = link.transport;
+        buf[6] = link.csq;
+        buf[7] = (uint8_t)link.rssi;
+        buf[8] = link.upKbps >> 8;   buf[9] = link.upKbps & 0xFF;
+        buf[10] = link.downKbps >> 8; buf[11] = link.downKbps & 0xFF;
+        buf[12] = link.burst >> 24; buf[13] = link.burst >> 16;
+        buf[14] = link.burst >> 8;  buf[15] = link.burst & 0xFF;
+        n = 16;
+    }
+    buf[n++] = (uint8_t)(len >> 24);
+    buf[n++] = (uint8_t)(len >> 16);
+    buf[n++] = (uint8_t)(len >> 8);
+    buf[n++] = (uint8_t)len;
+    return n;
+}
+
+static RunResult run_once(const char *host, int port, const LinkInfo &link, const std::vector<uint8_t> &audio) {
+    RunResult r;
+    Clock::time_point t0 = Clock::now();
+
+    int fd = tcp_connect(host, port);
+    if (fd < 0) return r;
+    r.connect_ms = ms_since(t0);
+
+    // 1. 上传 (与设备相同: 链路头 + 长度 + 数据)
+    Clock::time_point tUp = Clock::now();
+    uint8_t hdr[20];
+    size_t hdrLen = build_header(link, (uint32_t)audio.size(), hdr);
+    if (!send_all(fd, hdr, hdrLen) || !send_all(fd, audio.data(), audio.size())) {
+        close(fd);
+        return r;
+    }
+    r.upload_bytes = audio.size() + hdrLen;
+    r.upload_ms = ms_since(tUp);
+    Clock::time_point tWait = Clock::now();
+
+    // 2. 接收: Hex JSON + '*' + 音频
+    std::string jsonHex;
+    bool jsonDone = false;
+    uint8_t buf[2048];
+    for (;;) {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) break;
+        for (ssize_t i = 0; i < n; i++) {
+            uint8_t c = buf[i];
+            if (!jsonDone) {
+                if (c == '*') {
+                    jsonDone = true;
+                    r.json_ms = ms_since(tWait);
+                } else if (c != '\n' && c != '\r') {
+                    jsonHex += (char)c;
+                }
+            } else {
+                if (r.audio_bytes == 0) r.first_audio_ms = ms_since(tWait);
+                r.audio_bytes++;
+            }
+        }
+    }
+    close(fd);
+    r.total_ms = ms_since(t0);
+
+    for (size_t k = 0; k + 1 < jsonHex.size(); k += 2)
+        r.json += (char)((hex_val(jsonHex[k]) << 4) | hex_val(jsonHex[k + 1]));
+    r.json_bytes = jsonHex.size();
+    r.ok = jsonDone;
+    return r;
+}
+
+static std::string json_escape(const std::string &s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') { out += '\\'; out += c; }
+        else if ((unsigned char)c < 0x20) { char e[8]; snprintf(e, sizeof(e), "\\u%04x", c); out += e; }
+        else out += c;
+    }
+    return out;
+}
+
+static double percentile(std::vector<double> v, double p) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    size_t idx = (size_t)std::lround(p * (v.size() - 1));
+    return v[idx];
+}
+
+int main(int argc, char **argv) {
+    const char *host = "127.0.0.1";
+    int port = 8080;
+    int runs = 5;
+    int synthMs = 3000;
+    const char *fixture = nullptr;
+    const char *jsonOut = nullptr;
+    LinkInfo link;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        bool hasVal = i + 1 < argc;
+        if (a == "--host" && hasVal) host = argv[++i];
+        else if (a == "--port" && hasVal) port = atoi(argv[++i]);
+        else if (a == "--runs" && hasVal) runs = atoi(argv[++i]);
+        else if (a == "--synth-ms" && hasVal) synthMs = atoi(argv[++i]);
+        else if (a == "--fixture" && hasVal) fixture = argv[++i];
+        else if (a == "--json" && hasVal) jsonOut = argv[++i];
+        else if (a == "--transport" && hasVal) link.transport = std::string(argv[++i]) == "4g" ? 1 : 0;
+        else if (a == "--csq" && hasVal) link.csq = (uint8_t)atoi(argv[++i]);
+        else if (a == "--burst" && hasVal) link.burst = (uint32_t)atol(argv[++i]);
+        else if (a == "--legacy") link.legacy = true;
+        else {
+            fprintf(stderr, "usage: %s [--host H] [--port P] [--runs N] [--fixture F | --synth-ms MS] [--json OUT]\n"
+                            "          [--transport wifi|4g] [--csq N] [--burst BYTES] [--legacy]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<uint8_t> audio;
+    if (fixture) {
+        if (!load_fixture(fixture, audio)) { fprintf(stderr, "cannot read fixture %s\n", fixture); return 1; }
+    } else {
+        audio = synth_fixture(synthMs);
+    }
+
+    std::vector<RunResult> results;
+    for (int i = 0; i < runs; i++) {
+        RunResult r = run_once(host, port, link, audio);
+        printf("[run %d] %s connect %.1f ms, upload %.1f ms, json %.1f ms, first audio %.1f ms, total %.1f ms, audio %zu bytes\n",
+               i + 1, r.ok ? "OK  " : "FAIL", r.connect_ms, r.upload_ms, r.json_ms, r.first_audio_ms, r.total_ms, r.audio_bytes);
+        results.push_back(r);
+    }
+
+    std::vector<double> jsonMs, firstMs, totalMs;
+    int okCount = 0;
+    for (const RunResult &r : results) {
+        if (!r.ok) continue;
+        okCount++;
+        jsonMs.push_back(r.json_ms);
+        firstMs.push_back(r.first_audio_ms);
+        totalMs.push_back(r.total_ms);
+    }
+    printf("summary: %d/%d ok, json p50 %.1f ms, first audio p50 %.1f ms, total p50 %.1f ms\n",
+           okCount, runs, percentile(jsonMs, 0.5), percentile(firstMs, 0.5), percentile(totalMs, 0.5));
+
+    if (jsonOut) {
+        FILE *f = fopen(jsonOut, "w");
+        if (!f) { fprintf(stderr, "cannot write %s\n", jsonOut); return 1; }
+        fprintf(f, "{\n  \"host\": \"%s\", \"port\": %d, \"upload_bytes\": %zu,\n"
+                   "  \"link\": {\"legacy\": %s, \"transport\": \"%s\", \"csq\": %d, \"burst\": %u},\n  \"runs\": [\n",
+                json_escape(host).c_str(), port, audio.size(), link.legacy ? "true" : "false",
+                link.transport ? "4g" : "wifi", link.csq, link.burst);
+        for (size_t i = 0; i < results.size(); i++) {
+            const RunResult &r = results[i];
+            fprintf(f,
+                    "    {\"ok\": %s, \"connect_ms\": %.3f, \"upload_ms\": %.3f, \"json_ms\": %.3f, "
+                    "\"first_audio_ms\": %.3f, \"total_ms\": %.3f, \"json_bytes\": %zu, \"audio_bytes\": %zu, "
+                    "\"json\": \"%s\"}%s\n",
+                    r.ok ? "true" : "false", r.connect_ms, r.upload_ms, r.json_ms, r.first_audio_ms, r.total_ms,
+                    r.json_bytes, r.audio_bytes, json_escape(r.json).c_str(), i + 1 < results.size() ? "," : "");
+        }
+        fprintf(f,
+                "  ],\n  \"summary\": {\"ok\": %d, \"json_ms_p50\": %.3f, \"json_ms_p95\": %.3f, "
+                "\"first_audio_ms_p50\": %.3f, \"first_audio_ms_p95\": %.3f, \"total_ms_p50\": %.3f, \"total_ms_p95\": %.3f}\n}\n",
+                okCount, percentile(jsonMs, 0.5), percentile(jsonMs, 0.95), percentile(firstMs, 0.5),
+                percentile(firstMs, 0.95), percentile(totalMs, 0.5), percentile(totalMs, 0.95));
+        fclose(f);
+    }
+    return okCount == runs ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+"""
+端到端基准: 用 mock ASR/NLU/TTS 启动 ai_server.py，再用 panel_sim 模拟面板请求
+    cmake -S tools/panel_sim -B build/panel_sim && cmake --build build/panel_sim
+    python tools/panel_sim/run_bench.py --runs 10
+结果写到 bench_results/<时间>_<git 版本>.json，便于按版本对比趋势。
+"""
+import argparse
+import datetime
+import json
+import os
+import socket
+import subprocess
+import sys
+import time
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+
+def free_port():
+    with socket.socket() as s:
+        s.bind(("127.0.0.1", 0))
+        return s.getsockname()[1]
+
+
+def wait_port(port, timeout=15.0):
+    end = time.time() + timeout
+    while time.time() < end:
+        try:
+            with socket.create_connection(("127.0.0.1", port), timeout=0.5):
+                return True
+        except OSError:
+            time.sleep(0.1)
+    return False
+
+
+def git_rev():
+    try:
+        return subprocess.check_output(["git", "rev-parse", "--short", "HEAD"], cwd=ROOT, text=True).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--sim", default=os.path.join(ROOT, "build", "panel_sim", "panel_sim"))
+    parser.add_argument("--runs", type=int, default=5)
+    parser.add_argument("--synth-ms", type=int, default=3000)
+    parser.add_argument("--fixture")
+    parser.add_argument("--nlu-delay", type=float, default=0.0, help="模拟 NLU 耗时 (秒)")
+    parser.add_argument("--tts-delay", type=float, default=0.0, help="模拟 TTS 首包耗时 (秒)")
+    parser.add_argument("--out-dir", default=os.path.join(ROOT, "bench_results"))
+    parser.add_argument("sim_args", nargs="*", help="透传给 panel_sim 的参数，如 -- --transport 4g --csq 12")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.sim):
+        print(f"找不到 panel_sim: {args.sim} (先用 cmake 编译 tools/panel_sim)")
+        return 1
+
+    port = free_port()
+    env = dict(os.environ, SERVER_PORT=str(port), ASR_BACKEND="mock", NLU_BACKEND="mock", TTS_BACKEND="mock",
+               MOCK_NLU_DELAY=str(args.nlu_delay), MOCK_TTS_DELAY=str(args.tts_delay), PYTHONUNBUFFERED="1")
+    server = subprocess.Popen([sys.executable, os.path.join(ROOT, "ai_server.py")], cwd=ROOT, env=env,
+                              stdout=subprocess.DEVNULL, stderr=subprocess.STDOUT)
+    try:
+        if not wait_port(port):
+            print("ai_server.py 未能启动")
+            return 1
+        # wait_port 本身占用了一次 accept，让服务端先处理掉这个空连接
+        time.sleep(0.2)
+
+        os.makedirs(args.out_dir, exist_ok=True)
+        stamp = datetime.datetime.now().strftime("%Y%m%d_%H%M%S")
+        out = os.path.join(args.out_dir, f"{stamp}_{git_rev()}.json")
+        cmd = [args.sim, "--port", str(port), "--runs", str(args.runs), "--json", out]
+        cmd += ["--fixture", args.fixture] if args.fixture else ["--synth-ms", str(args.synth_ms)]
+        cmd += args.sim_args
+        rc = subprocess.call(cmd)
+
+        with open(out, encoding="utf-8") as f:
+            result = json.load(f)
+        result["meta"] = {"git": git_rev(), "time": stamp, "backends": "mock",
+                          "nlu_delay": args.nlu_delay, "tts_delay": args.tts_delay}
+        with open(out, "w", encoding="utf-8") as f:
+            json.dump(result, f, ensure_ascii=False, indent=2)
+        print(f"结果: {out}")
+        return rc
+    finally:
+        server.terminate()
+        server.wait(5)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
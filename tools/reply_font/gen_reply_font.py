@@ -0,0 +1,89 @@
+"""
+回复页中文子集字体: 从服务端词表收集字符，用 lv_font_conv 生成 ui_font_Reply.c
+    python tools/reply_font/gen_reply_font.py --font NotoSansSC-Regular.otf   # 生成并 LZ4 压缩
+    python tools/reply_font/gen_reply_font.py --list                          # 只列出字符集
+字符来源: ai_server.py 里的全部字符串常量 (固定回复、NLU 提示词里的示例) + vocab.txt (常用字)
++ ASCII 可见字符。LLM 回复里出现词表外的字时该字显示为空，把它加进 vocab.txt 再生成即可。
+生成的文件放在仓库根目录，并加进 CMakeLists.txt 的 SOURCES；没有这个文件时回复页用默认字体，
+只显示默认字体画得出的回复 (ASCII)，其余回复只打印到串口。
+需要 node (npx lv_font_conv@1.5.2)。
+"""
+import argparse
+import ast
+import os
+import subprocess
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+HERE = os.path.dirname(os.path.abspath(__file__))
+OUT = os.path.join(ROOT, "ui_font_Reply.c")
+
+# 回复里常见的全角标点
+PUNCT = "，。！？、；：“”‘’（）《》…—～·"
+
+
+def server_strings(path):
+    with open(path, encoding="utf-8") as f:
+        tree = ast.parse(f.read())
+    for node in ast.walk(tree):
+        if isinstance(node, ast.Constant) and isinstance(node.value, str):
+            yield node.value
+
+
+def collect(server, vocab):
+    chars = set(chr(c) for c in range(0x20, 0x7F))
+    chars.update(PUNCT)
+    for s in server_strings(server):
+        chars.update(c for c in s if ord(c) >= 0x2E80)   # 只取 CJK 及全角符号
+    if os.path.exists(vocab):
+        with open(vocab, encoding="utf-8") as f:
+            chars.update(c for c in f.read() if not c.isspace())
+    return "".join(sorted(chars))
+
+
+def run_font_conv(font, size, bpp, symbols):
+    cmd = ["npx", "--yes", "lv_font_conv@1.5.2",
+           "--font", font, "--size", str(size), "--bpp", str(bpp),
+           "--format", "lvgl", "--no-compress", "--no-prefilter", "--no-kerning",
+           "--lv-font-name", "ui_font_Reply",
+           "--symbols", symbols, "-o", OUT]
+    subprocess.check_call(cmd)
+
+    # 与 SquareLine 导出的字体保持同样的开头，asset_pack 按这个格式改写
+    with open(OUT, encoding="utf-8") as f:
+        text = f.read()
+    start = text.index("#ifdef LV_LVGL_H_INCLUDE_SIMPLE")
+    end = text.index("#endif", start) + len("#endif")
+    text = text[:start] + '#include "ui.h"' + text[end:]
+    with open(OUT, "w", encoding="utf-8") as f:
+        f.write(text)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--font", help="TTF/OTF 中文字体文件")
+    ap.add_argument("--size", type=int, default=14)
+    ap.add_argument("--bpp", type=int, default=2, help="2bpp 在 128x128 小屏上够用，比 4bpp 小一半")
+    ap.add_argument("--server", default=os.path.join(ROOT, "ai_server.py"))
+    ap.add_argument("--vocab", default=os.path.join(HERE, "vocab.txt"))
+    ap.add_argument("--list", action="store_true", help="只打印字符集")
+    ap.add_argument("--no-pack", action="store_true", help="不做 LZ4 压缩")
+    args = ap.parse_args()
+
+    symbols = collect(args.server, args.vocab)
+    cjk = sum(1 for c in symbols if ord(c) >= 0x2E80)
+    print("charset: %d chars (%d CJK)" % (len(symbols), cjk))
+    if args.list:
+        print(symbols)
+        return
+    if not args.font:
+        sys.exit("--font is required (e.g. NotoSansSC-Regular.otf)")
+
+    run_font_conv(args.font, args.size, args.bpp, symbols)
+    print("wrote %s" % OUT)
+    if not args.no_pack:
+        subprocess.check_call([sys.executable, os.path.join(ROOT, "tools", "asset_pack", "asset_pack.py"), OUT])
+
+
+if __name__ == "__main__":
+    main()
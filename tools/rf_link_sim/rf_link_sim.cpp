@@ -0,0 +1,359 @@
+/**
+ * @file rf_link_sim.cpp
+ * @brief 433MHz 链路层主机回环模拟 (与固件共用 Rf_Link.h)
+ * @details
+ * 面板和一个传感器节点各跑一个 RfLink，中间是模拟的空中信道，时间是虚拟的 (us)。
+ * 按 App_433.cpp 的实际流程计时:
+ *   发送: 写 4 个寄存器 + 逐字节写 FIFO -> GO_TX -> 空中时间 -> 按 1ms tick 轮询 TX_DONE -> 回到 RX
+ *   接收: 包收完 PKT_OK 中断 -> 任务唤醒 -> 读 RSSI、切 STBY、逐字节读 FIFO -> 回到 RX
+ * FIFO 只放得下一包，没读走又来一包算溢出；收端不在 RX (正在发或刚发完) 时帧丢失；
+ * 另外按给定概率随机丢帧。传感器收到请求后立即回 ACK (POLL 带 4 字节读数)，
+ * ACK 丢了由重发补回时也要带着读数 (empty 列应为 0)。
+ * 输出每种丢包率下的成功率、平均发送次数、每条命令的空中时间和往返延迟分布。
+ *   rf_link_sim [--bitrate 9600] [--n 2000] [--loss 0,0.05,0.2] [--seed 1] [--json]
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "Rf_Link.h"
+
+// 与 App_433.h 一致
+static const uint8_t kPanelId = 0x01;
+static const uint8_t kSensorId = 0x21;
+static const uint8_t kPreamble = 4;
+static const uint8_t kSync = 2;
+static const uint8_t kRetries = 3;
+static const uint32_t kTurnaroundUs = 3000;
+
+// SPI3 2MHz: 寄存器事务 16 位 + 片选建立/保持，FIFO 每字节 8 位 + 片选 + 4us 间隔
+static const uint32_t kRegUs = 12;
+static const uint32_t kFifoByteUs = 10;
+static const uint32_t kIsrWakeUs = 50;      // 中断到 Task433 运行
+static const uint32_t kTickUs = 1000;       // TX_DONE 轮询间隔 (vTaskDelay(1))
+static const uint32_t kSensorProcessUs = 200;
+
+static const uint32_t kTxSetupUs = 4 * kRegUs + RF_FRAME_LEN * kFifoByteUs + kRegUs;   // STBY..GO_TX
+static const uint32_t kRxReadUs = 2 * kRegUs + RF_FRAME_LEN * kFifoByteUs;             // RSSI + STBY + FIFO
+static const uint32_t kGoRxUs = 6 * kRegUs;                                             // RX_GoReceive
+
+class Sim;
+
+class SimNode : public RfRadio {
+public:
+    SimNode(Sim& sim, uint8_t id, bool reactive) : _sim(sim), _id(id), _reactive(reactive) {}
+
+    bool send(const uint8_t* frame, size_t len) override;
+    bool receive(uint8_t* frame, uint32_t timeoutUs) override;
+    void defer(const uint8_t* frame) override { _deferred.push_back(std::vector<uint8_t>(frame, frame + RF_FRAME_LEN)); }
+    uint32_t nowUs() override;
+
+    // 一帧收完 (PKT_OK)
+    void arrive(const uint8_t* frame, uint64_t startUs, uint64_t endUs);
+
+    RfLink* link = NULL;
+    SimNode* peer = NULL;
+    uint64_t rxFromUs = 0;      // 这之前不在 RX
+    uint32_t overruns = 0;
+    uint32_t deaf = 0;          // 到达时不在 RX
+    std::vector<std::vector<uint8_t> > _deferred;
+
+private:
+    Sim& _sim;
+    uint8_t _id;
+    bool _reactive;             // 传感器: 收到就处理 (在事件里直接回 ACK)
+    bool _fifoFull = false;
+    uint64_t _fifoReadyUs = 0;
+    uint8_t _fifo[RF_FRAME_LEN];
+};
+
+struct Delivery {
+    uint64_t atUs;
+    uint64_t startUs;
+    SimNode* to;
+    uint8_t frame[RF_FRAME_LEN];
+    bool operator>(const Delivery& o) const { return atUs > o.atUs; }
+};
+
+class Sim {
+public:
+    Sim(uint32_t bitrate, double loss, uint32_t seed) : bitrate(bitrate), loss(loss), _rng(seed ? seed : 1) {}
+
+    uint32_t airtimeUs() const {
+        return (uint32_t)((uint64_t)(kPreamble + kSync + RF_FRAME_LEN) * 8 * 1000000 / bitrate);
+    }
+    uint32_t preambleUs() const { return (uint32_t)((uint64_t)(kPreamble + kSync) * 8 * 1000000 / bitrate); }
+
+    void transmit(SimNode* to, const uint8_t* frame, uint64_t startUs) {
+        onAirUs += airtimeUs();
+        frames++;
+        if (nextRandom() < loss) {
+            lost++;
+            return;
+        }
+        Delivery d;
+        d.atUs = startUs + airtimeUs();
+        d.startUs = startUs;
+        d.to = to;
+        memcpy(d.frame, frame, RF_FRAME_LEN);
+        _events.push(d);
+    }
+
+    // 处理 untilUs 之前的事件；stop 返回 true 时提前结束
+    template <class Stop>
+    void runUntil(uint64_t untilUs, Stop stop) {
+        while (!_events.empty() && _events.top().atUs <= untilUs) {
+            Delivery d = _events.top();
+            _events.pop();
+            if (d.atUs > now) now = d.atUs;
+            d.to->arrive(d.frame, d.startUs, d.atUs);
+            if (stop()) return;
+        }
+        if (untilUs > now) now = untilUs;
+    }
+
+    uint64_t now = 0;
+    uint32_t bitrate;
+    double loss;
+    uint64_t onAirUs = 0;
+    uint32_t frames = 0;
+    uint32_t lost = 0;
+
+private:
+    double nextRandom() {
+        _rng ^= _rng << 13;
+        _rng ^= _rng >> 17;
+        _rng ^= _rng << 5;
+        return (_rng & 0xFFFFFF) / (double)0x1000000;
+    }
+
+    uint32_t _rng;
+    std::priority_queue<Delivery, std::vector<Delivery>, std::greater<Delivery> > _events;
+};
+
+uint32_t SimNode::nowUs() {
+    return (uint32_t)_sim.now;
+}
+
+bool SimNode::send(const uint8_t* frame, size_t len) {
+    (void)len;
+    if (_reactive) {
+        // 在到达事件里被调用: 读 FIFO、处理之后开始发，不推进全局时钟
+        uint64_t start = _sim.now + kIsrWakeUs + kRxReadUs + kSensorProcessUs + kTxSetupUs;
+        _sim.transmit(peer, frame, start);
+        rxFromUs = start + _sim.airtimeUs() + kRegUs + kGoRxUs;   // 传感器用中断等 TX_DONE
+        return true;
+    }
+
+    uint64_t start = _sim.now + kTxSetupUs;
+    uint64_t end = start + _sim.airtimeUs();
+    _sim.transmit(peer, frame, start);
+    // 发完之后按 tick 轮询 TX_DONE，再回到 RX
+    uint64_t seen = (end + kTickUs - 1) / kTickUs * kTickUs + kRegUs;
+    rxFromUs = seen + kGoRxUs;
+    _sim.runUntil(rxFromUs, [] { return false; });
+    return true;
+}
+
+void SimNode::arrive(const uint8_t* frame, uint64_t startUs, uint64_t endUs) {
+    // 前导和同步字期间收端必须已经在 RX
+    if (startUs + _sim.preambleUs() < rxFromUs) {
+        deaf++;
+        return;
+    }
+    if (_reactive) {
+        link->onReceive(frame);
+        return;
+    }
+    if (_fifoFull) overruns++;
+    memcpy(_fifo, frame, RF_FRAME_LEN);
+    _fifoFull = true;
+    _fifoReadyUs = endUs + kIsrWakeUs + kRxReadUs;
+}
+
+bool SimNode::receive(uint8_t* frame, uint32_t timeoutUs) {
+    uint64_t deadline = _sim.now + timeoutUs;
+    _sim.runUntil(deadline, [this] { return _fifoFull; });
+    if (!_fifoFull) return false;
+    // 读 FIFO 的时间也算进去，读完回到 RX
+    if (_fifoReadyUs > _sim.now) _sim.runUntil(_fifoReadyUs, [] { return false; });
+    memcpy(frame, _fifo, RF_FRAME_LEN);
+    _fifoFull = false;
+    rxFromUs = _sim.now + kGoRxUs;
+    return true;
+}
+
+// 传感器: POLL 回 4 字节读数 (温度 0.1 度、湿度 %、电量 %)
+static size_t sensorHandler(const RfFrame& req, uint8_t* reply, void* ctx) {
+    (void)ctx;
+    if (req.type != RF_T_POLL) return 0;
+    reply[0] = 0x00;
+    reply[1] = 0xF5;    // 24.5 度
+    reply[2] = 55;
+    reply[3] = 90;
+    return 4;
+}
+
+struct Result {
+    double loss;
+    uint32_t n;
+    uint32_t ok;
+    uint32_t retries;
+    uint32_t duplicates;
+    uint32_t emptyPolls;    // POLL 成功但 ACK 没有读数
+    uint32_t lost;
+    uint32_t deaf;
+    uint32_t overruns;
+    double airtimePerCmdUs;
+    uint32_t latMin, latP50, latP95, latMax;
+    double latAvg;
+    uint32_t rttMin, rttMax;
+    double rttAvg;
+};
+
+static uint32_t percentile(std::vector<uint32_t>& v, double p) {
+    if (v.empty()) return 0;
+    size_t i = (size_t)(p * (v.size() - 1) + 0.5);
+    return v[i];
+}
+
+static Result runOnce(uint32_t bitrate, double loss, uint32_t n, uint32_t seed) {
+    Sim sim(bitrate, loss, seed);
+    SimNode panel(sim, kPanelId, false);
+    SimNode sensor(sim, kSensorId, true);
+    panel.peer = &sensor;
+    sensor.peer = &panel;
+
+    RfLinkConfig cfg = { bitrate, kPreamble, kSync, kRetries, kTurnaroundUs };
+    RfLink panelLink(panel, kPanelId, cfg);
+    RfLink sensorLink(sensor, kSensorId, cfg);
+    sensorLink.setHandler(sensorHandler, NULL);
+    panel.link = &panelLink;
+    sensor.link = &sensorLink;
+
+    std::vector<uint32_t> lat;
+    uint32_t ok = 0, emptyPolls = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint8_t cmd[2] = { (uint8_t)(i & 1), 0x01 };   // 继电器 1 开/关
+        bool poll = (i % 2) == 0;
+        uint64_t t0 = sim.now;
+        RfFrame reply;
+        bool acked = poll ? panelLink.transact(kSensorId, RF_T_POLL, NULL, 0, &reply)
+                          : panelLink.transact(kSensorId, RF_T_CMD, cmd, sizeof(cmd), &reply);
+        if (acked) {
+            ok++;
+            if (poll && reply.len != 4) emptyPolls++;
+            lat.push_back((uint32_t)(sim.now - t0));
+        }
+        for (size_t k = 0; k < panel._deferred.size(); k++) panelLink.onReceive(panel._deferred[k].data());
+        panel._deferred.clear();
+        // 命令之间空闲 100ms，迟到的 ACK 在这里落地
+        sim.runUntil(sim.now + 100000, [] { return false; });
+    }
+
+    std::sort(lat.begin(), lat.end());
+    const RfLinkStats& ls = panelLink.stats();
+    Result r;
+    r.loss = loss;
+    r.n = n;
+    r.ok = ok;
+    r.retries = ls.retries;
+    r.duplicates = sensorLink.stats().duplicates;
+    r.emptyPolls = emptyPolls;
+    r.lost = sim.lost;
+    r.deaf = panel.deaf + sensor.deaf;
+    r.overruns = panel.overruns;
+    r.airtimePerCmdUs = n ? (double)sim.onAirUs / n : 0;
+    r.latMin = lat.empty() ? 0 : lat.front();
+    r.latMax = lat.empty() ? 0 : lat.back();
+    r.latP50 = percentile(lat, 0.5);
+    r.latP95 = percentile(lat, 0.95);
+    double sum = 0;
+    for (size_t i = 0; i < lat.size(); i++) sum += lat[i];
+    r.latAvg = lat.empty() ? 0 : sum / lat.size();
+    r.rttMin = ls.minRttUs;
+    r.rttMax = ls.maxRttUs;
+    r.rttAvg = ls.acked ? (double)ls.sumRttUs / ls.acked : 0;
+    return r;
+}
+
+int main(int argc, char** argv) {
+    uint32_t bitrate = 9600;
+    uint32_t n = 2000;
+    uint32_t seed = 1;
+    bool json = false;
+    std::vector<double> losses;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--bitrate") && i + 1 < argc) {
+            bitrate = (uint32_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--n") && i + 1 < argc) {
+            n = (uint32_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = (uint32_t)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--loss") && i + 1 < argc) {
+            std::string s = argv[++i];
+            size_t pos = 0;
+            while (pos < s.size()) {
+                size_t comma = s.find(',', pos);
+                if (comma == std::string::npos) comma = s.size();
+                losses.push_back(atof(s.substr(pos, comma - pos).c_str()));
+                pos = comma + 1;
+            }
+        } else if (!strcmp(argv[i], "--json")) {
+            json = true;
+        } else {
+            fprintf(stderr, "usage: %s [--bitrate bps] [--n count] [--loss a,b,c] [--seed s] [--json]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (bitrate == 0 || n == 0) return 2;
+    if (losses.empty()) {
+        losses.push_back(0.0);
+        losses.push_back(0.05);
+        losses.push_back(0.2);
+    }
+
+    Sim probe(bitrate, 0, 1);
+    RfLinkConfig cfg = { bitrate, kPreamble, kSync, kRetries, kTurnaroundUs };
+    SimNode dummy(probe, 0, false);
+    RfLink timing(dummy, 0, cfg);
+
+    std::vector<Result> results;
+    for (size_t i = 0; i < losses.size(); i++) results.push_back(runOnce(bitrate, losses[i], n, seed));
+
+    if (json) {
+        printf("{\"bitrate\":%u,\"frame_bytes\":%d,\"airtime_us\":%u,\"ack_timeout_us\":%u,\"tx_setup_us\":%u,"
+               "\"rx_read_us\":%u,\"runs\":[",
+               bitrate, RF_FRAME_LEN, timing.airtimeUs(), timing.ackTimeoutUs(), kTxSetupUs, kRxReadUs);
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result& r = results[i];
+            printf("%s{\"loss\":%.3f,\"commands\":%u,\"acked\":%u,\"retries\":%u,\"duplicates\":%u,\"empty_polls\":%u,\"lost\":%u,"
+                   "\"deaf\":%u,\"overruns\":%u,\"airtime_per_cmd_us\":%.0f,"
+                   "\"latency_us\":{\"min\":%u,\"avg\":%.0f,\"p50\":%u,\"p95\":%u,\"max\":%u},"
+                   "\"rtt_us\":{\"min\":%u,\"avg\":%.0f,\"max\":%u}}",
+                   i ? "," : "", r.loss, r.n, r.ok, r.retries, r.duplicates, r.emptyPolls, r.lost, r.deaf, r.overruns,
+                   r.airtimePerCmdUs, r.latMin, r.latAvg, r.latP50, r.latP95, r.latMax, r.rttMin, r.rttAvg, r.rttMax);
+        }
+        printf("]}\n");
+        return 0;
+    }
+
+    printf("bitrate %u bps, %d-byte frame: airtime %.2f ms, ACK timeout %.2f ms, TX setup %u us, RX readout %u us\n",
+           bitrate, RF_FRAME_LEN, timing.airtimeUs() / 1000.0, timing.ackTimeoutUs() / 1000.0, kTxSetupUs, kRxReadUs);
+    printf("%6s %7s %7s %6s %5s %5s %5s %9s | %-36s | %s\n", "loss", "acked", "retry", "dup", "empty", "deaf", "ovr",
+           "air/cmd", "latency ms (min avg p50 p95 max)", "RTT ms (min avg max)");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        printf("%5.1f%% %6.2f%% %7u %6u %5u %5u %5u %7.1fms | %6.1f %6.1f %6.1f %6.1f %6.1f | %6.1f %6.1f %6.1f\n",
+               r.loss * 100, 100.0 * r.ok / r.n, r.retries, r.duplicates, r.emptyPolls, r.deaf, r.overruns,
+               r.airtimePerCmdUs / 1000, r.latMin / 1000.0, r.latAvg / 1000, r.latP50 / 1000.0, r.latP95 / 1000.0,
+               r.latMax / 1000.0, r.rttMin / 1000.0, r.rttAvg / 1000, r.rttMax / 1000.0);
+    }
+    return 0;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file lv_conf.h
+ * @brief 主机渲染基准用的 LVGL 8.3 配置
+ * @details 颜色格式与 SquareLine 工程一致 (16 位、不交换字节)，其余未列出的项取 LVGL 默认值。
+ * 固件里用的是 Arduino 库目录下的 lv_conf.h，改动显示相关配置时两边要同步。
+ */
+#if 1
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#include <stdint.h>
+
+#define LV_COLOR_DEPTH          16
+#define LV_COLOR_16_SWAP        0
+
+#define LV_MEM_CUSTOM           0
+#define LV_MEM_SIZE             (48U * 1024U)
+
+#define LV_DISP_DEF_REFR_PERIOD 30
+#define LV_INDEV_DEF_READ_PERIOD 30
+#define LV_TICK_CUSTOM          0
+
+#define LV_USE_LOG              0
+#define LV_USE_ASSERT_NULL      1
+#define LV_USE_ASSERT_MALLOC    1
+#define LV_USE_PERF_MONITOR     0
+#define LV_USE_MEM_MONITOR      0
+
+#define LV_FONT_MONTSERRAT_14   1
+#define LV_FONT_DEFAULT         &lv_font_montserrat_14
+
+#define LV_USE_QRCODE           1
+#define LV_USE_THEME_DEFAULT    1
+
+#define LV_BUILD_EXAMPLES       0
+
+#endif /*LV_CONF_H*/
+#endif
@@ -0,0 +1,114 @@
+"""
+UI 渲染基准: 多次运行 ui_bench，取每个场景最好的一次，可与基线对比
+    cmake -S . -B build/ui_bench -DUI_HOST_BENCH=ON && cmake --build build/ui_bench
+    python tools/ui_bench/run_ui_bench.py --runs 5 [--baseline bench_results/ui_xxx.json]
+结果写到 bench_results/ui_<时间>_<git 版本>.json。
+与基线对比时: 渲染耗时 (p95) 超出 --tolerance 视为退化；刷新面积和 LVGL 堆是确定值，只要变大就算退化。
+"""
+import argparse
+import datetime
+import json
+import os
+import subprocess
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+DEFAULT_BIN = os.path.join(ROOT, "build", "ui_bench", "tools", "ui_bench", "ui_bench")
+
+
+def git_rev():
+    try:
+        return subprocess.check_output(["git", "rev-parse", "--short", "HEAD"], cwd=ROOT, text=True).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def run_once(binary, extra):
+    out = subprocess.check_output([binary] + extra, text=True)
+    return json.loads(out)
+
+
+def merge_best(runs):
+    # 耗时取各次运行的最小值 (去掉主机调度噪声)，其它字段取第一次
+    best = runs[0]
+    for run in runs[1:]:
+        for mine, other in zip(best["scenarios"], run["scenarios"]):
+            for key in ("p50", "p95", "max"):
+                mine["render_us"][key] = min(mine["render_us"][key], other["render_us"][key])
+        for key in best["construct_us"]:
+            best["construct_us"][key] = min(best["construct_us"][key], run["construct_us"][key])
+        best["reply"]["us_per_line"] = min(best["reply"]["us_per_line"], run["reply"]["us_per_line"])
+    return best
+
+
+def compare(result, baseline, tolerance):
+    regressions = []
+    base = {s["name"]: s for s in baseline["scenarios"]}
+    for s in result["scenarios"]:
+        b = base.get(s["name"])
+        if b is None:
+            continue
+        name = s["name"]
+        limit = b["render_us"]["p95"] * (1 + tolerance / 100.0)
+        if s["render_us"]["p95"] > limit and s["render_us"]["p95"] - b["render_us"]["p95"] > 50:
+            regressions.append("%s: p95 %d us > baseline %d us" % (name, s["render_us"]["p95"], b["render_us"]["p95"]))
+        if s["invalidated_px"]["total"] > b["invalidated_px"]["total"]:
+            regressions.append("%s: invalidated %d px > baseline %d px" %
+                               (name, s["invalidated_px"]["total"], b["invalidated_px"]["total"]))
+        if s["heap"]["max_used"] > b["heap"]["max_used"]:
+            regressions.append("%s: heap max %d B > baseline %d B" % (name, s["heap"]["max_used"], b["heap"]["max_used"]))
+    base_line = baseline.get("reply", {}).get("us_per_line")
+    if base_line:
+        now_line = result["reply"]["us_per_line"]
+        if now_line > base_line * (1 + tolerance / 100.0) and now_line - base_line > 2:
+            regressions.append("reply: %.1f us/line > baseline %.1f us/line" % (now_line, base_line))
+    return regressions
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--bin", default=DEFAULT_BIN)
+    ap.add_argument("--runs", type=int, default=5)
+    ap.add_argument("--full-frame", action="store_true")
+    ap.add_argument("--baseline", help="之前保存的结果文件")
+    ap.add_argument("--tolerance", type=float, default=15.0, help="渲染耗时允许的增幅 (%%)")
+    ap.add_argument("--out-dir", default=os.path.join(ROOT, "bench_results"))
+    args = ap.parse_args()
+
+    if not os.path.exists(args.bin):
+        sys.exit("ui_bench not found: %s (build with -DUI_HOST_BENCH=ON)" % args.bin)
+
+    extra = ["--full-frame"] if args.full_frame else []
+    result = merge_best([run_once(args.bin, extra) for _ in range(args.runs)])
+    result["git_rev"] = git_rev()
+    result["runs"] = args.runs
+
+    print("%-12s %7s %8s %8s %10s %9s" % ("scenario", "frames", "p50 us", "p95 us", "inval px", "heap max"))
+    for s in result["scenarios"]:
+        print("%-12s %7d %8d %8d %10d %9d" % (s["name"], s["frames"], s["render_us"]["p50"], s["render_us"]["p95"],
+                                              s["invalidated_px"]["total"], s["heap"]["max_used"]))
+    print("construct: %s" % ", ".join("%s %d us" % kv for kv in result["construct_us"].items()))
+    r = result["reply"]
+    print("reply: %d lines, layout %d us, %.1f us/line, glyph cache %d hit / %d miss" %
+          (r["lines"], r["layout_us"], r["us_per_line"], r["glyph_hits"], r["glyph_misses"]))
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    stamp = datetime.datetime.now().strftime("%Y%m%d_%H%M%S")
+    path = os.path.join(args.out_dir, "ui_%s_%s.json" % (stamp, result["git_rev"]))
+    with open(path, "w") as f:
+        json.dump(result, f, indent=2)
+    print("saved %s" % path)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            regressions = compare(result, json.load(f), args.tolerance)
+        if regressions:
+            print("REGRESSION:")
+            for r in regressions:
+                print("  " + r)
+            sys.exit(1)
+        print("no regression vs %s" % args.baseline)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,293 @@
+/**
+ * @file ui_bench.cpp
+ * @brief SquareLine UI 主机渲染基准
+ * @details
+ * 把 ui_init 生成的界面渲染到内存帧缓冲，按场景 (开机、空闲、状态栏刷新、焦点切换、
+ * 切到二维码页、切回主页、回复页滚动) 推进 LVGL 时钟，统计每帧渲染耗时、刷新面积和 LVGL 堆占用，
+ * 结果以 JSON 输出到 stdout。LVGL 时钟是模拟的，耗时用主机的真实时间测量。
+ * 回复页另外输出断行耗时和每行绘制耗时 (没有生成 ui_font_Reply 时用默认字体，中文字形为空)。
+ *   ui_bench [--full-frame] [--frames]
+ *     --full-frame  两块整屏缓冲 (对应固件 DISPLAY_FULL_FRAME=1)，默认 1/10 屏
+ *     --frames      输出每一帧的明细
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "lvgl.h"
+#include "ui.h"
+#include "App_Asset_Cache.h"
+#include "App_Reply_View.h"
+
+static const int kWidth = 128;
+static const int kHeight = 128;
+static const uint32_t kMaxSleepMs = 500;   // 固件 UI_MAX_SLEEP_MS
+
+static lv_color_t g_framebuffer[kWidth * kHeight];
+static lv_color_t g_buf1[kWidth * kHeight];
+static lv_color_t g_buf2[kWidth * kHeight];
+
+// 回复页场景的测试文字: 中英混排，带标点和换行，约 20 行
+static const char *kReplyText =
+    "好的，已经帮你把空调调到 24 度，制冷模式，风速自动。"
+    "Outside it is 31 degrees, so the cabin should cool down in about five minutes.\n"
+    "如果觉得风太大，可以跟我说\u201c风小一点\u201d，我会把风速调低；"
+    "想要更安静的话也可以切到睡眠模式。"
+    "Tip: long-press the AI button and say \"temperature 26\" to change it again.";
+
+struct FrameSample {
+    uint32_t renderUs;   // 这一帧所在的 lv_timer_handler 耗时
+    uint32_t px;         // 刷新的像素数
+    uint32_t flushes;    // flush_cb 调用次数
+};
+
+struct ScenarioResult {
+    std::string name;
+    std::vector<FrameSample> frames;
+    uint32_t heapUsed;
+    uint32_t heapMaxUsed;
+    uint8_t heapFragPct;
+};
+
+// 当前这次 lv_timer_handler 里累计的刷新
+static uint32_t g_pendingPx = 0;
+static uint32_t g_pendingFlushes = 0;
+static bool g_frameDone = false;
+
+static int64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void benchFlush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
+    int32_t w = area->x2 - area->x1 + 1;
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&g_framebuffer[y * kWidth + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+    g_pendingPx += w * (area->y2 - area->y1 + 1);
+    g_pendingFlushes++;
+    lv_disp_flush_ready(disp);
+}
+
+static void benchMonitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+    (void)disp;
+    (void)time;
+    if (px > 0) g_frameDone = true;
+}
+
+// 推进 ms 毫秒的模拟时间，把期间完成的帧记到 out。
+// 与固件 UI 任务一样，每次睡到 lv_timer_handler 返回的下一个期限 (1 ~ kMaxSleepMs)
+static void runFor(uint32_t ms, std::vector<FrameSample> &out) {
+    for (uint32_t t = 0; t < ms;) {
+        g_pendingPx = 0;
+        g_pendingFlushes = 0;
+        g_frameDone = false;
+
+        int64_t t0 = nowUs();
+        uint32_t next = lv_timer_handler();
+        int64_t t1 = nowUs();
+
+        if (g_frameDone) {
+            FrameSample f;
+            f.renderUs = (uint32_t)(t1 - t0);
+            f.px = g_pendingPx;
+            f.flushes = g_pendingFlushes;
+            out.push_back(f);
+        }
+
+        uint32_t step = std::min(std::max(next, (uint32_t)1), kMaxSleepMs);
+        step = std::min(step, ms - t);
+        lv_tick_inc(step);
+        t += step;
+    }
+}
+
+static ScenarioResult finish(const char *name, std::vector<FrameSample> &frames) {
+    ScenarioResult r;
+    r.name = name;
+    r.frames.swap(frames);
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    r.heapUsed = mon.total_size - mon.free_size;
+    r.heapMaxUsed = mon.max_used;
+    r.heapFragPct = mon.frag_pct;
+    return r;
+}
+
+// 二维码页用的 1-bit 测试图 (与 App_QR_Cache 生成的格式相同)
+static lv_img_dsc_t *makeTestQR() {
+    const int side = 110;
+    const int stride = (side + 7) / 8;
+    static std::vector<uint8_t> data(2 * sizeof(lv_color32_t) + stride * side);
+    lv_color32_t *palette = (lv_color32_t *)data.data();
+    palette[0].full = 0xFFFFFFFF;
+    palette[1].full = 0xFF000000;
+    uint8_t *px = data.data() + 2 * sizeof(lv_color32_t);
+    uint32_t seed = 1;
+    for (int my = 0; my < side / 5; my++) {
+        for (int mx = 0; mx < side / 5; mx++) {
+            seed = seed * 1103515245 + 12345;
+            if (!((seed >> 16) & 1)) continue;
+            for (int y = my * 5; y < my * 5 + 5; y++)
+                for (int x = mx * 5; x < mx * 5 + 5; x++) px[y * stride + (x >> 3)] |= 0x80 >> (x & 7);
+        }
+    }
+    static lv_img_dsc_t dsc;
+    memset(&dsc, 0, sizeof(dsc));
+    dsc.header.cf = LV_IMG_CF_INDEXED_1BIT;
+    dsc.header.w = side;
+    dsc.header.h = side;
+    dsc.data_size = data.size();
+    dsc.data = data.data();
+    return &dsc;
+}
+
+static void printStats(const std::vector<FrameSample> &frames, bool perFrame) {
+    std::vector<uint32_t> us;
+    uint64_t totalUs = 0, totalPx = 0;
+    uint32_t maxPx = 0;
+    for (size_t i = 0; i < frames.size(); i++) {
+        us.push_back(frames[i].renderUs);
+        totalUs += frames[i].renderUs;
+        totalPx += frames[i].px;
+        maxPx = std::max(maxPx, frames[i].px);
+    }
+    std::sort(us.begin(), us.end());
+    uint32_t p50 = us.empty() ? 0 : us[us.size() / 2];
+    uint32_t p95 = us.empty() ? 0 : us[std::min(us.size() - 1, us.size() * 95 / 100)];
+    uint32_t mx = us.empty() ? 0 : us.back();
+
+    printf("\"frames\": %u, \"render_us\": {\"p50\": %u, \"p95\": %u, \"max\": %u, \"total\": %llu}, "
+           "\"invalidated_px\": {\"total\": %llu, \"max\": %u}",
+           (unsigned)frames.size(), p50, p95, mx, (unsigned long long)totalUs,
+           (unsigned long long)totalPx, maxPx);
+    if (perFrame) {
+        printf(", \"frame_list\": [");
+        for (size_t i = 0; i < frames.size(); i++) {
+            printf("%s[%u, %u, %u]", i ? ", " : "", frames[i].renderUs, frames[i].px, frames[i].flushes);
+        }
+        printf("]");
+    }
+}
+
+int main(int argc, char **argv) {
+    bool fullFrame = false;
+    bool perFrame = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--full-frame") == 0) fullFrame = true;
+        else if (strcmp(argv[i], "--frames") == 0) perFrame = true;
+        else {
+            fprintf(stderr, "usage: %s [--full-frame] [--frames]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    lv_init();
+    asset_cache_init();
+
+    uint32_t bufPx = fullFrame ? kWidth * kHeight : kWidth * kHeight / 10;
+    static lv_disp_draw_buf_t drawBuf;
+    lv_disp_draw_buf_init(&drawBuf, g_buf1, g_buf2, bufPx);
+
+    static lv_disp_drv_t drv;
+    lv_disp_drv_init(&drv);
+    drv.hor_res = kWidth;
+    drv.ver_res = kHeight;
+    drv.flush_cb = benchFlush;
+    drv.monitor_cb = benchMonitor;
+    drv.draw_buf = &drawBuf;
+    lv_disp_drv_register(&drv);
+
+    std::vector<ScenarioResult> results;
+    std::vector<FrameSample> frames;
+
+    // 1. 开机: 构建全部界面并画出第一帧
+    int64_t t0 = nowUs();
+    ui_init();
+    uint32_t uiInitUs = (uint32_t)(nowUs() - t0);
+    runFor(100, frames);
+    results.push_back(finish("boot", frames));
+
+    // 2. 空闲: 没有任何变化时不应该有帧
+    runFor(2000, frames);
+    results.push_back(finish("main_idle", frames));
+
+    // 3. 状态栏: 模拟每秒一次的信号/时间刷新
+    for (int i = 0; i < 3; i++) {
+        if (ui_Bar4gsignal) lv_bar_set_value(ui_Bar4gsignal, 30 + i * 20, LV_ANIM_ON);
+        if (ui_LabelTime) lv_label_set_text_fmt(ui_LabelTime, "10:%02d", 30 + i);
+        runFor(1000, frames);
+    }
+    results.push_back(finish("status_bar", frames));
+
+    // 4. 焦点在两个按钮之间切换 (短按)
+    lv_group_t *group = lv_group_create();
+    if (ui_ButtonAI) lv_group_add_obj(group, ui_ButtonAI);
+    if (ui_ButtonLink) lv_group_add_obj(group, ui_ButtonLink);
+    for (int i = 0; i < 4; i++) {
+        lv_group_focus_next(group);
+        runFor(300, frames);
+    }
+    results.push_back(finish("focus", frames));
+
+    // 5. 切到二维码页 (与 AppUILogic::executeLongPressStart 相同的动画)
+    _ui_screen_change(&ui_QRScreen, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300, 0, &ui_QRScreen_screen_init);
+    if (ui_ImageQR) lv_img_set_src(ui_ImageQR, makeTestQR());
+    runFor(600, frames);
+    results.push_back(finish("to_qr", frames));
+
+    // 主页不在前台时重建一次，测量构建耗时
+    ui_MainScreen_screen_destroy();
+    t0 = nowUs();
+    ui_MainScreen_screen_init();
+    uint32_t mainInitUs = (uint32_t)(nowUs() - t0);
+
+    // 6. 切回主页
+    _ui_screen_change(&ui_MainScreen, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 300, 0, &ui_MainScreen_screen_init);
+    runFor(600, frames);
+    results.push_back(finish("to_main", frames));
+
+    ui_QRScreen_screen_destroy();
+    t0 = nowUs();
+    ui_QRScreen_screen_init();
+    uint32_t qrInitUs = (uint32_t)(nowUs() - t0);
+
+    // 7. 回复页: 切过去后停留再逐像素滚动到底
+    ui_ReplyScreen_screen_init();
+    lv_scr_load_anim(ui_ReplyScreen, LV_SCR_LOAD_ANIM_MOVE_LEFT, 300, 0, false);
+    MyReplyView.setText(kReplyText);
+    MyReplyView.resetStats();
+    runFor(REPLY_SCROLL_DELAY_MS + 8000, frames);
+    results.push_back(finish("reply_scroll", frames));
+    ReplyViewStats rv;
+    MyReplyView.getStats(&rv);
+
+    asset_cache_stats_t ac;
+    asset_cache_get_stats(&ac);
+
+    printf("{\n  \"config\": {\"width\": %d, \"height\": %d, \"buffer_px\": %u, \"full_frame\": %s},\n",
+           kWidth, kHeight, bufPx, fullFrame ? "true" : "false");
+    printf("  \"construct_us\": {\"ui_init\": %u, \"main_screen_init\": %u, \"qr_screen_init\": %u},\n",
+           uiInitUs, mainInitUs, qrInitUs);
+    printf("  \"reply\": {\"lines\": %u, \"layout_us\": %u, \"lines_drawn\": %u, \"us_per_line\": %.2f, "
+           "\"glyph_hits\": %u, \"glyph_misses\": %u},\n",
+           rv.lines, rv.layoutUs, rv.linesDrawn, rv.linesDrawn ? (double)rv.drawUs / rv.linesDrawn : 0.0,
+           rv.glyphHits, rv.glyphMisses);
+    printf("  \"asset_cache\": {\"hits\": %u, \"misses\": %u, \"bytes_peak\": %u, \"decode_us\": %u},\n",
+           ac.hits, ac.misses, ac.bytes_peak, ac.decode_us);
+    printf("  \"scenarios\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const ScenarioResult &r = results[i];
+        printf("    {\"name\": \"%s\", ", r.name.c_str());
+        printStats(r.frames, perFrame);
+        printf(", \"heap\": {\"used\": %u, \"max_used\": %u, \"frag_pct\": %u}}%s\n",
+               r.heapUsed, r.heapMaxUsed, r.heapFragPct, i + 1 < results.size() ? "," : "");
+    }
+    printf("  ]\n}\n");
+    return 0;
+}
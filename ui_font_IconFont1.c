@@ -5,6 +5,9 @@
  ******************************************************************************/
 
 #include "ui.h"
+#include "App_Asset_Cache.h"
+
+/* Packed by tools/asset_pack/asset_pack.py (LZ4) */
 
 #ifndef UI_FONT_ICONFONT1
 #define UI_FONT_ICONFONT1 1
@@ -18,133 +21,63 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+E900 "" */
-    0x0, 0x0, 0x0, 0x0, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0x26, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xf4, 0xb, 0xf5, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x1e, 0xd0, 0xef, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x8f, 0x2e, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x7, 0xf3, 0xef, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0xaf, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x5f, 0xb0, 0x5a, 0xaa, 0xdf, 0xff, 0xf4,
-    0x3, 0xd2, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0,
-    0x0,
-
-    /* U+E901 "" */
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xe9, 0x0, 0x0, 0x1, 0x90, 0x0, 0x5,
-    0xb0, 0xb, 0xf9, 0x0, 0x3, 0xee, 0x0, 0x5,
-    0xfe, 0x20, 0xb, 0xf9, 0x0, 0xdf, 0xe0, 0x5,
-    0xfe, 0x20, 0x0, 0x1b, 0xf9, 0x2, 0xee, 0x0,
-    0xaf, 0xb0, 0x2, 0xff, 0xff, 0xf9, 0x2, 0xc0,
-    0x0, 0xaf, 0xa0, 0x4f, 0xff, 0xff, 0xf9, 0x1,
-    0x0, 0x4, 0xfe, 0x24, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x4, 0xff, 0x30, 0x4f, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0xbf, 0xa0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0xcf, 0x80, 0x4f, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x3, 0xff, 0x20, 0x9a, 0xaa,
-    0xff, 0xff, 0xe0, 0x2, 0xef, 0x40, 0x0, 0x0,
-    0x3, 0xef, 0xfe, 0x0, 0xcf, 0x90, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xe0, 0x1, 0xdf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0x0, 0x1, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x1, 0x50,
-
-    /* U+E902 "" */
-    0x0, 0x0, 0x0, 0x0, 0x19, 0x0, 0x0, 0x2,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x0,
-    0x0, 0xd, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x24, 0x0, 0x9f, 0x50,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0x0, 0xdf, 0x20,
-    0x1f, 0xa0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x3f, 0xa0, 0xb, 0xf0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xc, 0xe0, 0x9, 0xf1, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xb, 0xf0, 0x8, 0xf2,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xe, 0xd0,
-    0xa, 0xf0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x8f, 0x70, 0xd, 0xd0, 0x8, 0xaa, 0xaf, 0xff,
-    0xff, 0x0, 0xac, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0x0, 0x0, 0xa,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+E903 "" */
-    0x0, 0x0, 0x1, 0x9d, 0xd9, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x39, 0x20, 0xff, 0xff, 0xff, 0xff, 0x2, 0x93,
-    0x3f, 0x80, 0xaf, 0xff, 0xff, 0xfa, 0x8, 0xf3,
-    0xd, 0xf1, 0x1d, 0xff, 0xff, 0xd1, 0x1e, 0xd0,
-    0x4, 0xfc, 0x10, 0x6b, 0xb6, 0x1, 0xcf, 0x40,
-    0x0, 0x8f, 0xe5, 0x0, 0x0, 0x5e, 0xf7, 0x0,
-    0x0, 0x6, 0xef, 0xfd, 0xdf, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x16, 0xbf, 0xfb, 0x61, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0, 0x0,
-
-    /* U+E904 "" */
-    0x3, 0x0, 0x0, 0x7, 0xbc, 0x80, 0x0, 0x0,
-    0x0, 0x7f, 0x60, 0x1, 0xdf, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x1d, 0xf7, 0x3, 0xf7, 0x0, 0x5f,
-    0xc0, 0x0, 0x0, 0x1, 0xdf, 0x70, 0x30, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x1d, 0xf7, 0x0,
-    0x0, 0x6, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x80, 0x0, 0x6, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf8, 0x0, 0x6, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x80, 0x6, 0xf3, 0x0, 0x0,
-    0x2, 0x72, 0xf, 0xdd, 0xf8, 0x4, 0xf1, 0x17,
-    0x30, 0x2, 0xf9, 0x9, 0xf8, 0xdf, 0x90, 0x30,
-    0x6f, 0x40, 0x0, 0xcf, 0x11, 0xdf, 0xff, 0xf9,
-    0x0, 0xcf, 0x0, 0x0, 0x4f, 0xc1, 0x8, 0xcd,
-    0xef, 0x90, 0x47, 0x0, 0x0, 0x7, 0xfe, 0x60,
-    0x0, 0x1d, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xff, 0xdd, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x6a, 0xff, 0xb7, 0x19, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0xa,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0,
-    0x0, 0x93, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+E905 "" */
-    0x0, 0x0, 0x0, 0x8, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x3,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf1, 0x1f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8a, 0x9, 0xf1, 0x1f, 0x90, 0x8a,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x9, 0xf1, 0x1f,
-    0x90, 0xce, 0x0, 0x0, 0x3, 0x10, 0xce, 0x9,
-    0xf1, 0x1f, 0x90, 0xce, 0x1, 0x30, 0x1f, 0x90,
-    0xce, 0x9, 0xf1, 0x1f, 0x90, 0xce, 0x9, 0xf1,
-    0x1f, 0x90, 0xce, 0x9, 0xf1, 0x1f, 0x90, 0xce,
-    0x9, 0xf1, 0x1f, 0x90, 0xce, 0x9, 0xf1, 0x1f,
-    0x90, 0xce, 0x9, 0xf1, 0x2, 0x10, 0xce, 0x9,
-    0xf1, 0x1f, 0x90, 0xce, 0x1, 0x20, 0x0, 0x0,
-    0xce, 0x9, 0xf1, 0x1f, 0x90, 0xce, 0x0, 0x0,
-    0x0, 0x0, 0x79, 0x9, 0xf1, 0x1f, 0x90, 0x79,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x1f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf1, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x20, 0x1f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0x70, 0x0,
-    0x0, 0x0
+    /* U+0020 */
+    /* U+E900 */
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x82, 0x05, 0x00, 0x40, 0x00, 0x01, 0xbf, 0x40, 0x08, 0x00, 0x30,
+    0x02, 0xdf, 0xf4, 0x07, 0x00, 0xf0, 0x07, 0x05, 0xff, 0xff, 0x40, 0x26, 0x00, 0xbf, 0xff, 0xff,
+    0xff, 0xf4, 0x0b, 0xf5, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x40, 0x1e, 0xd0, 0xef, 0x0f, 0x00, 0x31,
+    0x00, 0x8f, 0x2e, 0x0f, 0x00, 0x22, 0x07, 0xf3, 0x0f, 0x00, 0x21, 0xaf, 0x1d, 0x0f, 0x00, 0xe1,
+    0x5f, 0xb0, 0x5a, 0xaa, 0xdf, 0xff, 0xf4, 0x03, 0xd2, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x4b, 0x00,
+    0x21, 0x00, 0x8f, 0x4b, 0x00, 0xe0, 0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00,
+    /* U+E901 */
+    0x22, 0x01, 0x00, 0x01, 0x00, 0xf0, 0x3e, 0x02, 0xe9, 0x00, 0x00, 0x01, 0x90, 0x00, 0x05, 0xb0,
+    0x0b, 0xf9, 0x00, 0x03, 0xee, 0x00, 0x05, 0xfe, 0x20, 0x0b, 0xf9, 0x00, 0xdf, 0xe0, 0x05, 0xfe,
+    0x20, 0x00, 0x1b, 0xf9, 0x02, 0xee, 0x00, 0xaf, 0xb0, 0x02, 0xff, 0xff, 0xf9, 0x02, 0xc0, 0x00,
+    0xaf, 0xa0, 0x4f, 0xff, 0xff, 0xf9, 0x01, 0x00, 0x04, 0xfe, 0x24, 0xff, 0xff, 0xff, 0xfa, 0x00,
+    0x04, 0xff, 0x30, 0x4f, 0xff, 0xff, 0xff, 0xf9, 0x00, 0xbf, 0xa0, 0x04, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x00, 0xcf, 0x80, 0x11, 0x00, 0xf0, 0x0f, 0xfe, 0x00, 0x03, 0xff, 0x20, 0x9a, 0xaa, 0xff,
+    0xff, 0xe0, 0x02, 0xef, 0x40, 0x00, 0x00, 0x03, 0xef, 0xfe, 0x00, 0xcf, 0x90, 0x00, 0x00, 0x00,
+    0x01, 0xcf, 0xe0, 0x01, 0xdf, 0x60, 0x75, 0x00, 0xd0, 0xae, 0x00, 0x01, 0xdf, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x00, 0x01, 0x50,
+    /* U+E902 */
+    0x90, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x02, 0x30, 0x09, 0x00, 0x60, 0x03, 0xef, 0x00,
+    0x00, 0x0d, 0xe2, 0x0a, 0x00, 0xf1, 0x0d, 0x5f, 0xff, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00,
+    0x08, 0xff, 0xff, 0x00, 0x24, 0x00, 0x9f, 0x50, 0x1e, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdf, 0x20,
+    0x1f, 0xa0, 0x2f, 0x0a, 0x00, 0x42, 0x3f, 0xa0, 0x0b, 0xf0, 0x0a, 0x00, 0x42, 0x0c, 0xe0, 0x09,
+    0xf1, 0x0a, 0x00, 0x42, 0x0b, 0xf0, 0x08, 0xf2, 0x0a, 0x00, 0x33, 0x0e, 0xd0, 0x0a, 0x1e, 0x00,
+    0xf0, 0x12, 0x8f, 0x70, 0x0d, 0xd0, 0x08, 0xaa, 0xaf, 0xff, 0xff, 0x00, 0xac, 0x00, 0x4f, 0x80,
+    0x00, 0x00, 0x02, 0xdf, 0xff, 0x00, 0x00, 0x00, 0xdf, 0x20, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x00,
+    0x00, 0x0a, 0xf8, 0x6e, 0x00, 0xf0, 0x02, 0x00, 0x9f, 0x00, 0x00, 0x0a, 0xa0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+E903 */
+    0xe0, 0x00, 0x00, 0x01, 0x9d, 0xd9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xe2, 0x08,
+    0x00, 0xf0, 0x01, 0xbf, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x02, 0x08, 0x00, 0x1f, 0x20, 0x08, 0x00, 0x06, 0x20, 0x39, 0x20, 0x20, 0x00, 0xf0,
+    0x21, 0x02, 0x93, 0x3f, 0x80, 0xaf, 0xff, 0xff, 0xfa, 0x08, 0xf3, 0x0d, 0xf1, 0x1d, 0xff, 0xff,
+    0xd1, 0x1e, 0xd0, 0x04, 0xfc, 0x10, 0x6b, 0xb6, 0x01, 0xcf, 0x40, 0x00, 0x8f, 0xe5, 0x00, 0x00,
+    0x5e, 0xf7, 0x00, 0x00, 0x06, 0xef, 0xfd, 0xdf, 0xfe, 0x60, 0x00, 0x00, 0x00, 0x16, 0xbf, 0xfb,
+    0x61, 0x68, 0x00, 0x31, 0x00, 0x0d, 0xd0, 0x07, 0x00, 0x0d, 0x08, 0x00, 0x50, 0x02, 0x20, 0x00,
+    0x00, 0x00,
+    /* U+E904 */
+    0xf0, 0x14, 0x03, 0x00, 0x00, 0x07, 0xbc, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x60, 0x01, 0xdf, 0xff,
+    0xfe, 0x20, 0x00, 0x00, 0x1d, 0xf7, 0x03, 0xf7, 0x00, 0x5f, 0xc0, 0x00, 0x00, 0x01, 0xdf, 0x70,
+    0x30, 0x00, 0x0a, 0xf2, 0x00, 0x13, 0x00, 0x50, 0x00, 0x00, 0x06, 0xf3, 0x00, 0x13, 0x00, 0x12,
+    0x80, 0x09, 0x00, 0x33, 0x00, 0x2f, 0xf8, 0x09, 0x00, 0x30, 0x1f, 0xff, 0x80, 0x1b, 0x00, 0xf0,
+    0x26, 0x02, 0x72, 0x0f, 0xdd, 0xf8, 0x04, 0xf1, 0x17, 0x30, 0x02, 0xf9, 0x09, 0xf8, 0xdf, 0x90,
+    0x30, 0x6f, 0x40, 0x00, 0xcf, 0x11, 0xdf, 0xff, 0xf9, 0x00, 0xcf, 0x00, 0x00, 0x4f, 0xc1, 0x08,
+    0xcd, 0xef, 0x90, 0x47, 0x00, 0x00, 0x07, 0xfe, 0x60, 0x00, 0x1d, 0xf9, 0x00, 0x00, 0x00, 0x00,
+    0x5e, 0xff, 0xdd, 0xff, 0xff, 0xa0, 0x0a, 0x00, 0x50, 0x6a, 0xff, 0xb7, 0x19, 0xfa, 0x09, 0x00,
+    0x51, 0x00, 0xce, 0x00, 0x00, 0xaf, 0x13, 0x00, 0x41, 0xce, 0x00, 0x00, 0x0a, 0x26, 0x00, 0xe0,
+    0xce, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00,
+    /* U+E905 */
+    0x63, 0x00, 0x00, 0x00, 0x08, 0xe1, 0x00, 0x01, 0x00, 0x42, 0x09, 0xf1, 0x03, 0x10, 0x0b, 0x00,
+    0x4b, 0x09, 0xf1, 0x1f, 0x90, 0x0a, 0x00, 0x10, 0x8a, 0x14, 0x00, 0x10, 0x8a, 0x15, 0x00, 0x10,
+    0xce, 0x0a, 0x00, 0x52, 0xce, 0x00, 0x00, 0x03, 0x10, 0x0a, 0x00, 0x42, 0x01, 0x30, 0x1f, 0x90,
+    0x0a, 0x00, 0x01, 0x19, 0x00, 0x0d, 0x05, 0x00, 0x14, 0x02, 0x28, 0x00, 0x32, 0x20, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x46, 0x00, 0x10, 0x79, 0x28, 0x00, 0x10, 0x79, 0x0a, 0x00, 0x10, 0x00, 0x0a,
+    0x00, 0x01, 0x09, 0x00, 0x07, 0x0a, 0x00, 0x24, 0x01, 0x20, 0x82, 0x00, 0x70, 0x00, 0x00, 0x1d,
+    0x70, 0x00, 0x00, 0x00,
 };
 
 
@@ -182,6 +115,23 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 
 
 
+/*Compressed glyphs, sorted by unicode (see App_Asset_Cache.h)*/
+static const asset_glyph_t glyph_pack[] = {
+    {.unicode = 0x0020, .offset = 0, .packed_len = 0, .raw_len = 0},
+    {.unicode = 0xE900, .offset = 0, .packed_len = 100, .raw_len = 113},
+    {.unicode = 0xE901, .offset = 100, .packed_len = 134, .raw_len = 136},
+    {.unicode = 0xE902, .offset = 234, .packed_len = 136, .raw_len = 150},
+    {.unicode = 0xE903, .offset = 370, .packed_len = 114, .raw_len = 152},
+    {.unicode = 0xE904, .offset = 484, .packed_len = 158, .raw_len = 171},
+    {.unicode = 0xE905, .offset = 642, .packed_len = 100, .raw_len = 170},
+};
+
+static const asset_font_pack_t font_pack = {
+    .glyphs = glyph_pack,
+    .glyph_cnt = 7,
+    .data = glyph_bitmap,
+};
+
 /*--------------------
  *  ALL CUSTOM DATA
  *--------------------*/
@@ -223,7 +173,7 @@ const lv_font_t ui_font_IconFont1 = {
 lv_font_t ui_font_IconFont1 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = asset_font_get_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 19,          /*The maximum line height required by the font*/
     .base_line = 1,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -237,7 +187,7 @@ lv_font_t ui_font_IconFont1 = {
 #if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
     .fallback = NULL,
 #endif
-    .user_data = NULL,
+    .user_data = (void *)&font_pack,
 };
 
 
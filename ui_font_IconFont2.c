@@ -5,6 +5,9 @@
  ******************************************************************************/
 
 #include "ui.h"
+#include "App_Asset_Cache.h"
+
+/* Packed by tools/asset_pack/asset_pack.py (LZ4) */
 
 #ifndef UI_FONT_ICONFONT2
 #define UI_FONT_ICONFONT2 1
@@ -18,357 +21,97 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+E990 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x9d, 0xff, 0xff, 0xff, 0xfc,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x2b, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xf4, 0x5e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+E994 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xab, 0xbb, 0xbb, 0xbb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb, 0x62,
-    0x13, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb5, 0x21, 0x25, 0xbb, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x53, 0x35, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x53, 0x45, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xbc, 0x62,
-    0x13, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc6, 0x32, 0x36, 0xcb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbb, 0xbb, 0xbb, 0xba, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+EAC3 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xb0, 0x0, 0x27, 0xab, 0xb9, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5b, 0x0, 0xc, 0xf3, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0xd,
-    0xf5, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x40,
-    0x0, 0x9f, 0x10, 0xe, 0xf6, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x22, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf0, 0x0, 0xbf, 0x30, 0xf,
-    0xf7, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x9, 0xf1,
-    0x0, 0xdf, 0x40, 0xf, 0xf7, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x5b, 0x0, 0xb, 0xf3, 0x0, 0xef, 0x60, 0xe,
-    0xf6, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xbf, 0x30, 0xd, 0xf5,
-    0x0, 0xff, 0x70, 0xd, 0xf5, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xef, 0x60, 0xf, 0xf7, 0x0, 0xef, 0x60, 0xb,
-    0xf3, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0x40, 0xe, 0xf6,
-    0x0, 0xcf, 0x40, 0xa, 0xf2, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x8f, 0x10, 0xc, 0xf4, 0x0, 0xbf, 0x30, 0x9,
-    0xf1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x13, 0x0, 0xa, 0xf2,
-    0x0, 0x9f, 0x10, 0x8, 0xf0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x8, 0xf0, 0x0, 0x7f, 0x0, 0x7,
-    0xf0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x4, 0xa0,
-    0x0, 0x4a, 0x0, 0x4, 0xa0, 0x0, 0x9b, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x71, 0x0,
-
-    /* U+EAE9 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xfe, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0x75, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x57, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xe2, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x2e, 0xff,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x8, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x7, 0xff, 0xff, 0x70, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x7, 0xff, 0xff, 0x70,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x7, 0xff, 0xff, 0x70, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x7, 0xff, 0xff, 0x70,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xf5,
-    0x7, 0xff, 0xff, 0x70, 0x5f, 0xff, 0xff, 0xff,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0x75,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xe9, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x9e, 0xfc, 0x40,
-    0x4f, 0xff, 0xff, 0xec, 0xcc, 0xcc, 0xcd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xcc, 0xcc,
-    0xce, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xb, 0xff, 0xfe, 0x53,
-    0x33, 0x33, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x93, 0x33, 0x33, 0x35, 0xef, 0xff, 0xb0,
-    0x0, 0x37, 0x51, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x15, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x8b,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0x9f, 0xff, 0xff, 0xfb,
-    0x7, 0xff, 0xff, 0x70, 0xbf, 0xff, 0xff, 0xf9,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xff, 0xb0, 0x7, 0xff, 0xff, 0x70,
-    0xb, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x7, 0xff, 0xff, 0x70, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x7, 0xff, 0xff, 0x70,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x7, 0xff, 0xff, 0x70, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0xec, 0x50, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x5, 0xce, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6a, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0
+    /* U+0020 */
+    /* U+E990 */
+    0x15, 0x00, 0x01, 0x00, 0x75, 0x02, 0x9d, 0xff, 0xff, 0xff, 0xfc, 0x71, 0x10, 0x00, 0x50, 0x00,
+    0x00, 0x00, 0x7f, 0xff, 0x01, 0x00, 0x26, 0xfe, 0x40, 0x14, 0x00, 0x10, 0x08, 0x11, 0x00, 0x46,
+    0xff, 0xff, 0xff, 0xf5, 0x13, 0x00, 0x13, 0x5f, 0x13, 0x00, 0x25, 0xff, 0x20, 0x14, 0x00, 0x14,
+    0xdf, 0x13, 0x00, 0x14, 0xa0, 0x13, 0x00, 0xb4, 0x03, 0xff, 0xff, 0xf9, 0x10, 0x00, 0x00, 0x2b,
+    0xff, 0xff, 0xf0, 0x13, 0x00, 0x40, 0x06, 0xff, 0xff, 0xc0, 0x0c, 0x00, 0x30, 0xef, 0xff, 0xf3,
+    0x07, 0x00, 0x00, 0x04, 0x00, 0x40, 0x07, 0xff, 0xff, 0x80, 0x08, 0x00, 0x30, 0xbf, 0xff, 0xf4,
+    0x07, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x08, 0x13, 0x00, 0x69, 0x14, 0x5e, 0xc8, 0x00, 0x40, 0xff,
+    0xff, 0xfe, 0x50, 0x8e, 0x00, 0x36, 0x00, 0x00, 0xef, 0x13, 0x00, 0x22, 0xff, 0xe0, 0x13, 0x00,
+    0x07, 0x12, 0x00, 0x04, 0xde, 0x00, 0x0f, 0x13, 0x00, 0xff, 0x44, 0x17, 0xbf, 0x57, 0x01, 0x12,
+    0xb0, 0x7c, 0x01, 0x25, 0x06, 0x88, 0x01, 0x00, 0x80, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00,
+    /* U+E994 */
+    0x13, 0x00, 0x01, 0x00, 0x43, 0xab, 0xbb, 0xbb, 0xbb, 0x0b, 0x00, 0x04, 0x07, 0x00, 0x64, 0x01,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x0e, 0x00, 0x02, 0x08, 0x00, 0x10, 0x04, 0x14, 0x00, 0x12, 0x40,
+    0x0c, 0x00, 0x04, 0x06, 0x00, 0x10, 0x0a, 0x14, 0x00, 0x14, 0xa0, 0x0e, 0x00, 0x02, 0x08, 0x00,
+    0x10, 0x3f, 0x14, 0x00, 0x12, 0xf3, 0x0c, 0x00, 0x03, 0x06, 0x00, 0x20, 0x02, 0xef, 0x14, 0x00,
+    0x19, 0xfe, 0x51, 0x00, 0x10, 0x4e, 0x13, 0x00, 0x33, 0xff, 0xff, 0xe4, 0x23, 0x00, 0x52, 0x00,
+    0xbb, 0x62, 0x13, 0x6c, 0x13, 0x00, 0x50, 0xff, 0xff, 0xb5, 0x21, 0x25, 0x92, 0x00, 0x01, 0x72,
+    0x00, 0x04, 0x14, 0x00, 0x00, 0x08, 0x00, 0x40, 0x40, 0x00, 0x00, 0x0d, 0x08, 0x00, 0x08, 0x04,
+    0x00, 0x48, 0xd0, 0x00, 0x00, 0x7f, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x31, 0xf6, 0x00, 0x01, 0x72,
+    0x00, 0x00, 0x0c, 0x00, 0x04, 0x04, 0x00, 0x33, 0xfe, 0x10, 0x09, 0x0b, 0x00, 0x43, 0xf9, 0x53,
+    0x35, 0x9f, 0x0b, 0x00, 0x22, 0x90, 0x1f, 0x09, 0x00, 0x53, 0xf9, 0x10, 0x00, 0x00, 0x01, 0x15,
+    0x00, 0x22, 0xf1, 0x05, 0x14, 0x00, 0x10, 0x70, 0x9a, 0x00, 0x12, 0x07, 0x0c, 0x00, 0x30, 0x50,
+    0x00, 0x5f, 0x09, 0x00, 0x10, 0xf9, 0x13, 0x00, 0x21, 0x00, 0x00, 0x29, 0x00, 0x31, 0xf4, 0x00,
+    0x00, 0x51, 0x00, 0x12, 0xe0, 0x14, 0x00, 0x10, 0x0e, 0x20, 0x00, 0x31, 0x90, 0x00, 0x00, 0x3a,
+    0x01, 0x01, 0x3b, 0x00, 0x21, 0x00, 0x00, 0x3d, 0x00, 0x00, 0xf5, 0x00, 0x52, 0xcf, 0xff, 0xff,
+    0xff, 0x20, 0x28, 0x00, 0x50, 0x02, 0xff, 0xff, 0xff, 0xfb, 0x0b, 0x00, 0x00, 0x45, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x04, 0x00, 0x31, 0xff, 0xff, 0xff, 0x5b, 0x00, 0x40, 0x8f, 0xff, 0xff, 0xff,
+    0x10, 0x00, 0x00, 0x04, 0x00, 0x40, 0xef, 0xff, 0xff, 0xf7, 0x08, 0x00, 0x0b, 0x28, 0x00, 0x10,
+    0xf8, 0x14, 0x00, 0x0f, 0x50, 0x00, 0x00, 0x0f, 0x78, 0x00, 0x01, 0x0f, 0xa0, 0x00, 0x01, 0x10,
+    0x4f, 0xa8, 0x00, 0x01, 0x6d, 0x00, 0x05, 0xc8, 0x00, 0x0f, 0xf0, 0x00, 0x01, 0x03, 0x18, 0x01,
+    0x10, 0xfa, 0x18, 0x01, 0x10, 0xaf, 0x33, 0x00, 0x31, 0xff, 0xff, 0xf1, 0x4f, 0x00, 0x63, 0xff,
+    0xff, 0xff, 0xfa, 0x53, 0x45, 0x13, 0x00, 0x2f, 0xff, 0x90, 0x68, 0x01, 0x01, 0x22, 0x00, 0x6f,
+    0x31, 0x00, 0x06, 0x06, 0x00, 0x1f, 0xf6, 0xb8, 0x01, 0x03, 0x0f, 0xe0, 0x01, 0x01, 0x27, 0x00,
+    0xbc, 0x08, 0x02, 0x40, 0xc6, 0x32, 0x36, 0xcb, 0xf0, 0x00, 0x00, 0x04, 0x00, 0x12, 0x5e, 0x4f,
+    0x00, 0x05, 0x30, 0x02, 0x00, 0x14, 0x00, 0x03, 0x58, 0x02, 0x03, 0x5b, 0x01, 0x00, 0x12, 0x00,
+    0x31, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x0a, 0x80, 0x02, 0x20, 0x00, 0x0b, 0x3d, 0x00, 0x0b, 0xa8,
+    0x02, 0x01, 0xf7, 0x00, 0x0b, 0xd0, 0x02, 0x01, 0x46, 0x01, 0x00, 0xb2, 0x01, 0x03, 0x4c, 0x00,
+    0x01, 0x07, 0x00, 0xc0, 0xbb, 0xbb, 0xbb, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+EAC3 */
+    0x12, 0x00, 0x01, 0x00, 0x72, 0x05, 0xb0, 0x00, 0x27, 0xab, 0xb9, 0x50, 0x0d, 0x00, 0x03, 0x06,
+    0x00, 0x83, 0x07, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0f, 0x00, 0x01, 0x07, 0x00, 0x11,
+    0x08, 0x14, 0x00, 0x31, 0xff, 0xfc, 0x10, 0x0e, 0x00, 0x02, 0x05, 0x00, 0x20, 0x09, 0xf1, 0x28,
+    0x00, 0x32, 0xff, 0xff, 0xc0, 0x0f, 0x00, 0x01, 0x06, 0x00, 0x22, 0x0a, 0xf2, 0x14, 0x00, 0x11,
+    0xf8, 0x0e, 0x00, 0x00, 0x05, 0x00, 0x42, 0x5b, 0x00, 0x0c, 0xf3, 0x14, 0x00, 0x15, 0xff, 0x3d,
+    0x00, 0x43, 0x8f, 0x00, 0x0d, 0xf5, 0x14, 0x00, 0x02, 0x66, 0x00, 0x73, 0x01, 0x40, 0x00, 0x9f,
+    0x10, 0x0e, 0xf6, 0x14, 0x00, 0x20, 0xb0, 0x22, 0x39, 0x00, 0x73, 0x07, 0xf0, 0x00, 0xbf, 0x30,
+    0x0f, 0xf7, 0x14, 0x00, 0xb7, 0xff, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x09, 0xf1, 0x00, 0xdf, 0x40,
+    0x14, 0x00, 0x95, 0xff, 0xa0, 0x5b, 0x00, 0x0b, 0xf3, 0x00, 0xef, 0x60, 0x3c, 0x00, 0x60, 0xff,
+    0xff, 0xff, 0xf6, 0xbf, 0x30, 0x5f, 0x00, 0x10, 0x70, 0x05, 0x00, 0x13, 0xff, 0x01, 0x00, 0x94,
+    0xfd, 0xef, 0x60, 0x0f, 0xf7, 0x00, 0xef, 0x60, 0x0b, 0x8c, 0x00, 0x00, 0x18, 0x00, 0x74, 0xcf,
+    0x40, 0x0e, 0xf6, 0x00, 0xcf, 0x40, 0xb4, 0x00, 0x00, 0x13, 0x00, 0x84, 0xfe, 0x8f, 0x10, 0x0c,
+    0xf4, 0x00, 0xbf, 0x30, 0xdc, 0x00, 0x00, 0x14, 0x00, 0x83, 0xfa, 0x13, 0x00, 0x0a, 0xf2, 0x00,
+    0x9f, 0x10, 0x04, 0x01, 0x00, 0x13, 0x00, 0x92, 0xff, 0xf2, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x7f,
+    0x00, 0x2c, 0x01, 0x01, 0x13, 0x00, 0x80, 0xfe, 0x40, 0x00, 0x00, 0x04, 0xa0, 0x00, 0x4a, 0x05,
+    0x00, 0xa0, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x71, 0x00,
+    /* U+EAE9 */
+    0x14, 0x00, 0x01, 0x00, 0x24, 0x03, 0x30, 0x0a, 0x00, 0x05, 0x08, 0x00, 0x45, 0x05, 0xef, 0xfe,
+    0x50, 0x0d, 0x00, 0x03, 0x09, 0x00, 0x43, 0x3f, 0xff, 0xff, 0xf3, 0x0b, 0x00, 0x05, 0x07, 0x00,
+    0x45, 0x9f, 0xff, 0xff, 0xf9, 0x0d, 0x00, 0x03, 0x09, 0x00, 0x43, 0xbf, 0xff, 0xff, 0xfb, 0x0b,
+    0x00, 0x00, 0x07, 0x00, 0x53, 0x05, 0x75, 0x00, 0x00, 0x00, 0x28, 0x00, 0x12, 0x57, 0x55, 0x00,
+    0xf0, 0x01, 0x02, 0xdf, 0xff, 0xe2, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x2e, 0xff,
+    0xfd, 0x20, 0x27, 0x00, 0xf0, 0x01, 0x0c, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x08, 0xff, 0xff, 0x80,
+    0x00, 0x00, 0xdf, 0xff, 0xff, 0xc0, 0x14, 0x00, 0xd1, 0x2f, 0xff, 0xff, 0xff, 0x20, 0x00, 0x07,
+    0xff, 0xff, 0x70, 0x00, 0x02, 0xff, 0x2e, 0x00, 0x72, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x60,
+    0x14, 0x00, 0x23, 0x06, 0xff, 0x92, 0x00, 0x52, 0x0f, 0xff, 0xff, 0xff, 0xf5, 0x14, 0x00, 0x50,
+    0x5f, 0xff, 0xff, 0xff, 0xf0, 0x3c, 0x00, 0x60, 0x07, 0xff, 0xff, 0xff, 0xff, 0x50, 0x3c, 0x00,
+    0x10, 0x05, 0x0a, 0x00, 0x10, 0x70, 0x14, 0x00, 0x20, 0x00, 0x5d, 0x29, 0x00, 0x00, 0x14, 0x00,
+    0x00, 0x27, 0x00, 0x11, 0xd5, 0x13, 0x00, 0xe3, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x57, 0xff,
+    0xff, 0x75, 0xff, 0xff, 0xff, 0xb0, 0x13, 0x00, 0x99, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xfc, 0xff,
+    0xff, 0xcf, 0xcb, 0x00, 0x00, 0x29, 0x00, 0x00, 0x4c, 0x00, 0x07, 0x27, 0x00, 0x01, 0x29, 0x00,
+    0x00, 0x14, 0x00, 0x03, 0xf2, 0x00, 0x42, 0x04, 0xcf, 0xe9, 0x00, 0x52, 0x00, 0x03, 0x4e, 0x00,
+    0xa0, 0x9e, 0xfc, 0x40, 0x4f, 0xff, 0xff, 0xec, 0xcc, 0xcc, 0xcd, 0x26, 0x00, 0xa2, 0xff, 0xff,
+    0xdc, 0xcc, 0xcc, 0xce, 0xff, 0xff, 0xf4, 0xcf, 0x0e, 0x00, 0x08, 0x06, 0x00, 0x18, 0xfc, 0x0d,
+    0x00, 0x04, 0x0c, 0x00, 0x14, 0xef, 0x09, 0x00, 0x06, 0x08, 0x00, 0x26, 0xfe, 0x8f, 0x0c, 0x00,
+    0x04, 0x0a, 0x00, 0x82, 0xf8, 0x0b, 0xff, 0xfe, 0x53, 0x33, 0x33, 0x38, 0x10, 0x00, 0xd0, 0x93,
+    0x33, 0x33, 0x35, 0xef, 0xff, 0xb0, 0x00, 0x37, 0x51, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0xf6,
+    0x00, 0x52, 0x00, 0x00, 0x00, 0x15, 0x73, 0xdf, 0x00, 0x01, 0x11, 0x01, 0x00, 0x2b, 0x00, 0x02,
+    0x8e, 0x01, 0x01, 0x15, 0x00, 0x03, 0x27, 0x00, 0x00, 0x48, 0x01, 0x01, 0x10, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x27, 0x00, 0x40, 0xb8, 0xff, 0xff, 0x8b, 0x48, 0x01, 0x03, 0x14, 0x00, 0x50, 0x06,
+    0x9f, 0xff, 0xff, 0xfb, 0x40, 0x01, 0x51, 0xbf, 0xff, 0xff, 0xf9, 0x60, 0x15, 0x00, 0x10, 0x02,
+    0xa3, 0x00, 0x10, 0xb0, 0x14, 0x00, 0x00, 0x1f, 0x01, 0x14, 0xfe, 0xcc, 0x01, 0x22, 0xff, 0xfb,
+    0x90, 0x01, 0x27, 0xbf, 0xff, 0xcc, 0x01, 0x12, 0xb0, 0x14, 0x00, 0x00, 0x29, 0x00, 0x10, 0xf2,
+    0x3d, 0x00, 0x00, 0xcc, 0x01, 0x12, 0x30, 0x14, 0x00, 0x18, 0x03, 0xcc, 0x01, 0x12, 0x00, 0x14,
+    0x00, 0x14, 0x00, 0xcc, 0x01, 0x41, 0x06, 0xff, 0xff, 0xf7, 0x56, 0x01, 0x40, 0xc0, 0x00, 0x00,
+    0x7f, 0xff, 0x01, 0x00, 0x3d, 0x00, 0xe0, 0x5c, 0xec, 0x50, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xf6,
+    0x00, 0x00, 0x05, 0xce, 0xc5, 0x12, 0x00, 0x03, 0x04, 0x00, 0x0b, 0x80, 0x02, 0x01, 0x16, 0x00,
+    0x0f, 0x14, 0x00, 0x01, 0x02, 0x3c, 0x00, 0x01, 0x1f, 0x00, 0x05, 0x05, 0x00, 0x18, 0x0b, 0x04,
+    0x02, 0x04, 0x16, 0x00, 0xb0, 0x6a, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
 
@@ -404,6 +147,21 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 
 
 
+/*Compressed glyphs, sorted by unicode (see App_Asset_Cache.h)*/
+static const asset_glyph_t glyph_pack[] = {
+    {.unicode = 0x0020, .offset = 0, .packed_len = 0, .raw_len = 0},
+    {.unicode = 0xE990, .offset = 0, .packed_len = 161, .raw_len = 722},
+    {.unicode = 0xE994, .offset = 161, .packed_len = 432, .raw_len = 820},
+    {.unicode = 0xEAC3, .offset = 593, .packed_len = 252, .raw_len = 360},
+    {.unicode = 0xEAE9, .offset = 845, .packed_len = 512, .raw_len = 820},
+};
+
+static const asset_font_pack_t font_pack = {
+    .glyphs = glyph_pack,
+    .glyph_cnt = 5,
+    .data = glyph_bitmap,
+};
+
 /*--------------------
  *  ALL CUSTOM DATA
  *--------------------*/
@@ -445,7 +203,7 @@ const lv_font_t ui_font_IconFont2 = {
 lv_font_t ui_font_IconFont2 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = asset_font_get_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 41,          /*The maximum line height required by the font*/
     .base_line = 3,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -459,7 +217,7 @@ lv_font_t ui_font_IconFont2 = {
 #if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
     .fallback = NULL,
 #endif
-    .user_data = NULL,
+    .user_data = (void *)&font_pack,
 };
 
 
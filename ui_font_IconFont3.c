@@ -5,6 +5,9 @@
  ******************************************************************************/
 
 #include "ui.h"
+#include "App_Asset_Cache.h"
+
+/* Packed by tools/asset_pack/asset_pack.py (LZ4) */
 
 #ifndef UI_FONT_ICONFONT3
 #define UI_FONT_ICONFONT3 1
@@ -18,541 +21,152 @@
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+E900 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0x77, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x40, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x22, 0x0, 0x0, 0x9f, 0x70, 0x0,
-    0x0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x2e, 0xe2,
-    0x0, 0x9f, 0xff, 0x70, 0x0, 0x2, 0xff, 0xf9,
-    0x0, 0x0, 0x2e, 0xff, 0xe2, 0xc, 0xff, 0xff,
-    0x70, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x2e, 0xff,
-    0xff, 0x40, 0x1c, 0xff, 0xff, 0x70, 0x2, 0xff,
-    0xf9, 0x0, 0x2e, 0xff, 0xff, 0x50, 0x0, 0x1c,
-    0xff, 0xff, 0x70, 0x2f, 0xff, 0x90, 0x2e, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x1c, 0xff, 0xff, 0x72,
-    0xff, 0xf9, 0x2e, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0x9f, 0xff, 0xbe, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+E901 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8c,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xca,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x6b, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7e,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3b,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xce, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xeb, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+E902 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfe, 0x5f, 0xff, 0x9a, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xfe, 0x22, 0xff, 0xf9,
-    0xa, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x4f, 0xff,
-    0xfe, 0x20, 0x2f, 0xff, 0x90, 0xa, 0xff, 0xff,
-    0xa0, 0x0, 0x4f, 0xff, 0xfe, 0x20, 0x2, 0xff,
-    0xf9, 0x0, 0xa, 0xff, 0xff, 0xa0, 0xe, 0xff,
-    0xfe, 0x20, 0x0, 0x2f, 0xff, 0x90, 0x0, 0xa,
-    0xff, 0xff, 0x60, 0x4f, 0xfe, 0x20, 0x0, 0x2,
-    0xff, 0xf9, 0x0, 0x0, 0xa, 0xff, 0xa0, 0x0,
-    0x3d, 0x20, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x0,
-    0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+E903 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xaa, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xe6, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x9f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe1, 0x0, 0x0, 0x1f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x0, 0x8,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x10, 0x0, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf7, 0x0, 0x5f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xd0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x20, 0xdf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf5,
-    0xf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x82, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfa, 0x3f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xb3, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x2f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xa1, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf9, 0xe, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x60, 0xbf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf3, 0x7, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfe, 0x0,
-    0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x90, 0x0, 0xbf, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xf3, 0x0, 0x4,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xfc, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x30, 0x0, 0x0, 0x2f,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf9, 0x40, 0x0, 0x0, 0x0, 0x27,
-    0xcf, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfd,
-    0xcb, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9c, 0xef, 0xff, 0xfd, 0xb7, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+E904 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5d, 0x30, 0x0, 0x0, 0x8,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xf8, 0x0, 0x3, 0xdf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd3, 0x9f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x89, 0x70, 0x0, 0x0, 0x0,
-    0x5e, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x39,
-    0x87, 0x20, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfb, 0x20, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xb3, 0x0,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x3, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x1f, 0xff, 0xff, 0xb8,
-    0xff, 0xff, 0xff, 0xd5, 0x2, 0xff, 0xf9, 0x1,
-    0xaf, 0xff, 0xff, 0xfb, 0x7e, 0xff, 0xff, 0x80,
-    0x9, 0xff, 0xa3, 0x0, 0x19, 0xff, 0xff, 0xff,
-    0xb5, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xfd, 0x40,
-    0x0, 0x7e, 0xff, 0x10, 0x1, 0xa2, 0x0, 0x0,
-    0x0, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x77, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x20, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x0, 0x5, 0xfa, 0x20, 0x0,
-    0x2, 0xaf, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xef,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x7, 0xec, 0x0,
-    0xd, 0xff, 0xfa, 0x30, 0x8f, 0xff, 0xff, 0xfc,
-    0x42, 0xff, 0xf9, 0x19, 0xff, 0xff, 0xff, 0xc3,
-    0x7, 0xef, 0xff, 0x40, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x60, 0x2, 0xff, 0xf9, 0x0,
-    0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x4d, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x30, 0x0, 0x18, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xfb, 0x30, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x3,
-    0xcf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfe, 0x50, 0x1b, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xa1, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0x0, 0x0, 0x0, 0x1,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+E905 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x88, 0x85, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf3, 0x0, 0x0, 0x2,
-    0x7b, 0xde, 0xdb, 0x73, 0x0, 0x0, 0x2, 0xef,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xc3, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x30, 0x0, 0x2, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xfe, 0xde, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe, 0x71, 0x0,
-    0x1, 0x6e, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbb, 0xbb, 0xb6, 0x0, 0x8, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf9, 0x0, 0x6, 0xbb, 0xbb, 0xb0, 0x1f, 0xff,
-    0xff, 0x80, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb0, 0x0,
-    0x8f, 0xff, 0xff, 0x11, 0xff, 0xff, 0xf8, 0x0,
-    0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfc, 0x0, 0x8, 0xff, 0xff,
-    0xf1, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x9f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xa0, 0x0, 0x8f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x4e, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xc6, 0x32, 0x36, 0xcf, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7,
-    0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xd6,
-    0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x26, 0x79, 0x86, 0x20, 0x0, 0x0, 0x6,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xaa, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x1, 0xd8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+    /* U+0020 */
+    /* U+E900 */
+    0x10, 0x00, 0x01, 0x00, 0x30, 0x17, 0x77, 0x40, 0x07, 0x00, 0x01, 0x04, 0x00, 0x31, 0x02, 0xff,
+    0xf9, 0x08, 0x00, 0x01, 0x05, 0x00, 0x31, 0x2f, 0xff, 0x90, 0x08, 0x00, 0x00, 0x05, 0x00, 0x0f,
+    0x19, 0x00, 0xe4, 0x32, 0x40, 0x00, 0x00, 0xfa, 0x00, 0x71, 0x22, 0x00, 0x00, 0x9f, 0x70, 0x00,
+    0x00, 0x13, 0x01, 0x62, 0x2e, 0xe2, 0x00, 0x9f, 0xff, 0x70, 0x19, 0x00, 0x71, 0x2e, 0xff, 0xe2,
+    0x0c, 0xff, 0xff, 0x70, 0x19, 0x00, 0x80, 0x2e, 0xff, 0xff, 0x40, 0x1c, 0xff, 0xff, 0x70, 0x32,
+    0x00, 0x50, 0x2e, 0xff, 0xff, 0x50, 0x00, 0x0d, 0x00, 0x31, 0x2f, 0xff, 0x90, 0x0c, 0x00, 0x00,
+    0x0d, 0x00, 0x32, 0x72, 0xff, 0xf9, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x30, 0x9f, 0xff, 0xbe, 0x24,
+    0x00, 0x20, 0x00, 0x00, 0x0d, 0x00, 0x23, 0xff, 0xff, 0x0c, 0x00, 0x03, 0x0d, 0x00, 0x10, 0x50,
+    0x74, 0x01, 0x03, 0x1a, 0x00, 0x03, 0x0c, 0x00, 0x01, 0x1a, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x0d,
+    0x00, 0x05, 0x0c, 0x00, 0x36, 0x00, 0x1c, 0xff, 0x0c, 0x00, 0x27, 0x00, 0x1c, 0x0c, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+E901 */
+    0x1f, 0x00, 0x01, 0x00, 0x03, 0x2c, 0x8c, 0x10, 0x18, 0x00, 0x2c, 0x8f, 0xfc, 0x13, 0x00, 0x3b,
+    0x8f, 0xff, 0xf8, 0x25, 0x00, 0x3f, 0x8f, 0xff, 0xfb, 0x12, 0x00, 0x20, 0x1d, 0x9f, 0x36, 0x00,
+    0x42, 0x9f, 0xff, 0xff, 0xdd, 0x01, 0x00, 0x22, 0xca, 0x84, 0x51, 0x00, 0x26, 0x9f, 0xff, 0x01,
+    0x00, 0x20, 0xfe, 0x81, 0x14, 0x00, 0x16, 0x0a, 0x11, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xf7, 0x13,
+    0x00, 0x10, 0xfb, 0xb0, 0x00, 0x40, 0x0a, 0xff, 0xff, 0x90, 0x1b, 0x00, 0x7a, 0x00, 0x00, 0x02,
+    0x6b, 0xff, 0xff, 0xfd, 0x13, 0x00, 0x50, 0x00, 0x02, 0xbf, 0xff, 0xfd, 0x1e, 0x00, 0x06, 0x26,
+    0x00, 0x5c, 0x00, 0x00, 0x6f, 0xff, 0xfa, 0x13, 0x00, 0x33, 0x5f, 0xff, 0xf5, 0x13, 0x00, 0x10,
+    0x80, 0x08, 0x00, 0x00, 0x04, 0x00, 0x30, 0x7f, 0xff, 0xd0, 0x07, 0x00, 0x30, 0x0a, 0xff, 0xd1,
+    0x07, 0x00, 0x01, 0x04, 0x00, 0x30, 0xcf, 0xff, 0x50, 0x08, 0x00, 0x16, 0x09, 0x12, 0x00, 0x30,
+    0x04, 0xff, 0xfc, 0x12, 0x00, 0x21, 0x00, 0x01, 0x06, 0x00, 0x01, 0x05, 0x00, 0x31, 0x0e, 0xff,
+    0xf0, 0x08, 0x00, 0x07, 0x05, 0x00, 0x37, 0x9f, 0xff, 0x40, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x30,
+    0x06, 0xff, 0xf6, 0x07, 0x00, 0x08, 0x04, 0x00, 0x38, 0x4f, 0xff, 0x70, 0x0f, 0x00, 0x42, 0x00,
+    0x00, 0x00, 0x04, 0xf4, 0x00, 0x08, 0x16, 0x00, 0x38, 0x5f, 0xff, 0x60, 0x0f, 0x00, 0x6b, 0x00,
+    0x00, 0x00, 0x08, 0xff, 0xf4, 0x12, 0x00, 0x30, 0x00, 0xcf, 0xff, 0x05, 0x01, 0x08, 0x16, 0x00,
+    0x12, 0x2f, 0xcc, 0x00, 0x07, 0x13, 0x00, 0x1d, 0x0b, 0x5c, 0x00, 0x3b, 0x04, 0xff, 0xfe, 0x37,
+    0x00, 0x2c, 0x02, 0xff, 0x93, 0x00, 0x2c, 0x03, 0xef, 0x49, 0x00, 0x47, 0x07, 0xff, 0xff, 0xe2,
+    0x57, 0x00, 0x52, 0x00, 0x00, 0x02, 0x7e, 0xff, 0x92, 0x00, 0x23, 0x3b, 0xbb, 0x01, 0x00, 0x50,
+    0xce, 0xff, 0xff, 0xff, 0xe3, 0x24, 0x00, 0x18, 0x05, 0xd0, 0x01, 0x10, 0xb1, 0x12, 0x00, 0x26,
+    0x00, 0x5f, 0x13, 0x00, 0x21, 0xfc, 0x30, 0x12, 0x00, 0x06, 0x25, 0x00, 0x21, 0xeb, 0x72, 0x11,
+    0x00, 0x0a, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+E902 */
+    0x11, 0x00, 0x01, 0x00, 0x11, 0x30, 0x06, 0x00, 0x02, 0x05, 0x00, 0x22, 0x4f, 0xa0, 0x08, 0x00,
+    0x00, 0x06, 0x00, 0x26, 0x4f, 0xff, 0x0d, 0x00, 0x26, 0x4f, 0xff, 0x0d, 0x00, 0x26, 0x4f, 0xff,
+    0x0d, 0x00, 0x00, 0x0c, 0x00, 0x04, 0x1a, 0x00, 0x01, 0x0c, 0x00, 0x03, 0x0d, 0x00, 0x02, 0x0c,
+    0x00, 0x02, 0x0d, 0x00, 0x62, 0x4f, 0xff, 0xfe, 0x5f, 0xff, 0x9a, 0x34, 0x00, 0x71, 0x4f, 0xff,
+    0xfe, 0x22, 0xff, 0xf9, 0x0a, 0x0d, 0x00, 0x71, 0x4f, 0xff, 0xfe, 0x20, 0x2f, 0xff, 0x90, 0x0d,
+    0x00, 0x00, 0x0c, 0x00, 0x40, 0x02, 0xff, 0xf9, 0x00, 0x0d, 0x00, 0x80, 0x0e, 0xff, 0xfe, 0x20,
+    0x00, 0x2f, 0xff, 0x90, 0x0d, 0x00, 0x50, 0x60, 0x4f, 0xfe, 0x20, 0x00, 0x19, 0x00, 0x81, 0x00,
+    0x0a, 0xff, 0xa0, 0x00, 0x3d, 0x20, 0x00, 0x19, 0x00, 0x22, 0x00, 0x0a, 0x9a, 0x00, 0x01, 0x19,
+    0x00, 0x00, 0xab, 0x00, 0x00, 0x04, 0x00, 0x00, 0x32, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00,
+    0x0f, 0x19, 0x00, 0xf4, 0x80, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+E903 */
+    0x13, 0x00, 0x01, 0x00, 0x33, 0x01, 0xaa, 0xa6, 0x0a, 0x00, 0x06, 0x07, 0x00, 0x36, 0x2f, 0xff,
+    0xa0, 0x0d, 0x00, 0x02, 0x0a, 0x00, 0x32, 0x02, 0xff, 0xfa, 0x09, 0x00, 0x02, 0x06, 0x00, 0x10,
+    0x01, 0x07, 0x00, 0x02, 0x27, 0x00, 0x01, 0x0b, 0x00, 0x83, 0x00, 0x00, 0x00, 0x03, 0xe6, 0x00,
+    0x00, 0x00, 0x27, 0x00, 0x10, 0xd9, 0x1f, 0x00, 0x82, 0x00, 0x00, 0x05, 0xff, 0xf2, 0x00, 0x00,
+    0x00, 0x27, 0x00, 0x21, 0x9f, 0xfc, 0x14, 0x00, 0x44, 0x05, 0xff, 0xff, 0xc0, 0x27, 0x00, 0x21,
+    0x4f, 0xff, 0x14, 0x00, 0x46, 0x02, 0xff, 0xff, 0xe3, 0x27, 0x00, 0x02, 0x68, 0x00, 0x36, 0xdf,
+    0xff, 0xe2, 0x4e, 0x00, 0x71, 0x8f, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x8f, 0x4d, 0x00, 0x03, 0x4e,
+    0x00, 0x90, 0x00, 0x9f, 0xff, 0xe1, 0x00, 0x00, 0x1f, 0xff, 0xf4, 0x55, 0x00, 0x03, 0x75, 0x00,
+    0x62, 0x00, 0xcf, 0xff, 0x90, 0x00, 0x08, 0x40, 0x00, 0x04, 0x27, 0x00, 0x50, 0x02, 0xff, 0xff,
+    0x10, 0x00, 0x04, 0x00, 0x06, 0x4e, 0x00, 0x63, 0x00, 0x09, 0xff, 0xf7, 0x00, 0x5f, 0xe2, 0x00,
+    0x02, 0x9c, 0x00, 0x00, 0xa4, 0x00, 0x22, 0xd0, 0x0a, 0x4d, 0x00, 0x04, 0xc3, 0x00, 0x70, 0x00,
+    0x00, 0xcf, 0xff, 0x20, 0xdf, 0xff, 0x60, 0x00, 0x00, 0x1f, 0x00, 0x02, 0x11, 0x01, 0x40, 0x07,
+    0xff, 0xf5, 0x0f, 0xc0, 0x00, 0x07, 0x4e, 0x00, 0x43, 0x00, 0x4f, 0xff, 0x82, 0x74, 0x00, 0x04,
+    0x75, 0x00, 0x00, 0x43, 0x00, 0x31, 0x3f, 0xff, 0x90, 0x3b, 0x00, 0x04, 0x9c, 0x00, 0x61, 0x00,
+    0x1f, 0xff, 0xb3, 0xff, 0xf8, 0x13, 0x00, 0x33, 0x00, 0x01, 0x11, 0x08, 0x00, 0x33, 0xff, 0xfb,
+    0x2f, 0x27, 0x00, 0x02, 0x11, 0x00, 0x10, 0x00, 0xd3, 0x00, 0x35, 0xa1, 0xff, 0xfb, 0x0e, 0x00,
+    0x01, 0x09, 0x00, 0x61, 0x03, 0xff, 0xf9, 0x0e, 0xff, 0xe0, 0x0b, 0x00, 0x05, 0x05, 0x00, 0x65,
+    0x6f, 0xff, 0x60, 0xbf, 0xff, 0x20, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x60, 0x0a, 0xff, 0xf3, 0x07,
+    0xff, 0xf7, 0x0a, 0x00, 0x06, 0x04, 0x00, 0x4b, 0xff, 0xfe, 0x00, 0x1f, 0x3b, 0x00, 0x76, 0x7f,
+    0xff, 0x90, 0x00, 0xbf, 0xff, 0x70, 0x24, 0x00, 0x73, 0x00, 0x00, 0x1e, 0xff, 0xf3, 0x00, 0x04,
+    0x25, 0x01, 0x03, 0x18, 0x00, 0x10, 0x08, 0x9b, 0x01, 0x10, 0x0b, 0x05, 0x00, 0x03, 0x11, 0x00,
+    0x00, 0xcd, 0x01, 0x20, 0xff, 0x30, 0x0a, 0x01, 0x07, 0x08, 0x02, 0x21, 0x03, 0xff, 0x47, 0x01,
+    0x14, 0x6f, 0x00, 0x01, 0x20, 0x00, 0x00, 0x48, 0x00, 0x10, 0xd0, 0x33, 0x00, 0x34, 0x9f, 0xff,
+    0xfd, 0x9f, 0x00, 0x22, 0x07, 0xff, 0xba, 0x01, 0x50, 0x00, 0xaf, 0xff, 0xff, 0x91, 0x1c, 0x00,
+    0x62, 0x00, 0x00, 0x4d, 0xff, 0xff, 0xf3, 0x0a, 0x00, 0xa2, 0x9f, 0xff, 0xff, 0xf9, 0x40, 0x00,
+    0x00, 0x00, 0x27, 0xcf, 0x06, 0x02, 0x00, 0x16, 0x00, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xfd, 0xcb,
+    0xbc, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x10, 0x00, 0x00, 0x04, 0x00, 0x10, 0x1a, 0x0e, 0x00, 0x00,
+    0x04, 0x00, 0x20, 0xfe, 0x50, 0x0f, 0x00, 0x01, 0x04, 0x00, 0x20, 0x02, 0x9f, 0x11, 0x00, 0x31,
+    0xff, 0xff, 0xc6, 0x0e, 0x00, 0x03, 0x05, 0x00, 0x64, 0x05, 0x9c, 0xef, 0xff, 0xfd, 0xb7, 0x7c,
+    0x00, 0x03, 0x15, 0x00, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00,
+    /* U+E904 */
+    0x1f, 0x00, 0x01, 0x00, 0x07, 0x69, 0x5d, 0x30, 0x00, 0x00, 0x08, 0xc0, 0x20, 0x00, 0x79, 0x01,
+    0xef, 0xf8, 0x00, 0x03, 0xdf, 0xf7, 0x14, 0x00, 0x88, 0x0b, 0xff, 0xff, 0xd3, 0x9f, 0xff, 0xff,
+    0x30, 0x15, 0x00, 0x88, 0x05, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x14, 0x00, 0x75, 0x00,
+    0x1a, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x13, 0x00, 0xf0, 0x01, 0x07, 0x89, 0x70, 0x00, 0x00, 0x00,
+    0x5e, 0xff, 0xff, 0x91, 0x00, 0x00, 0x00, 0x39, 0x87, 0x20, 0x19, 0x00, 0x90, 0x0f, 0xff, 0xd0,
+    0x00, 0x00, 0x00, 0x03, 0xff, 0xfa, 0x0d, 0x00, 0x30, 0x6f, 0xff, 0x60, 0x07, 0x00, 0x90, 0x0e,
+    0xff, 0xe0, 0x00, 0x00, 0x00, 0x02, 0xff, 0xf9, 0x0d, 0x00, 0x30, 0x7f, 0xff, 0x50, 0x07, 0x00,
+    0x36, 0x0d, 0xff, 0xf0, 0x14, 0x00, 0x21, 0x8f, 0xff, 0x55, 0x00, 0x18, 0x0c, 0x14, 0x00, 0x12,
+    0x9f, 0x90, 0x00, 0x36, 0x0b, 0xff, 0xf1, 0x28, 0x00, 0x21, 0xaf, 0xff, 0x64, 0x00, 0x44, 0x7f,
+    0xff, 0xfb, 0x20, 0x50, 0x00, 0xd2, 0x07, 0xff, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff,
+    0xff, 0xf9, 0x10, 0x64, 0x00, 0x30, 0x05, 0xdf, 0xff, 0x15, 0x00, 0x10, 0x4e, 0xc1, 0x00, 0x21,
+    0xff, 0xe7, 0x14, 0x00, 0x21, 0x03, 0xcf, 0x0d, 0x00, 0xf1, 0x20, 0xa0, 0x1f, 0xff, 0xff, 0xb8,
+    0xff, 0xff, 0xff, 0xd5, 0x02, 0xff, 0xf9, 0x01, 0xaf, 0xff, 0xff, 0xfb, 0x7e, 0xff, 0xff, 0x80,
+    0x09, 0xff, 0xa3, 0x00, 0x19, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xfd, 0x40,
+    0x00, 0x7e, 0xff, 0x10, 0x01, 0xa2, 0x00, 0x00, 0x00, 0x2b, 0x34, 0x00, 0x30, 0xff, 0xff, 0xfe,
+    0xc5, 0x00, 0x10, 0x77, 0xb5, 0x00, 0x42, 0x00, 0x00, 0x00, 0x4d, 0x15, 0x00, 0x13, 0x81, 0x0f,
+    0x00, 0x02, 0x07, 0x00, 0x00, 0x7e, 0x00, 0x10, 0xff, 0x33, 0x00, 0x02, 0x0f, 0x00, 0x01, 0x06,
+    0x00, 0x59, 0x09, 0xff, 0xff, 0xff, 0xfd, 0x53, 0x01, 0x12, 0x00, 0x54, 0x01, 0x14, 0xf9, 0x54,
+    0x01, 0x00, 0xcc, 0x00, 0x03, 0x99, 0x00, 0x11, 0xff, 0x91, 0x01, 0xf0, 0x12, 0x02, 0x00, 0x05,
+    0xfa, 0x20, 0x00, 0x02, 0xaf, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xef, 0xff, 0xff, 0xe5, 0x00, 0x00,
+    0x07, 0xec, 0x00, 0x0d, 0xff, 0xfa, 0x30, 0x8f, 0xff, 0xff, 0xfc, 0x42, 0xff, 0xf9, 0xa7, 0x00,
+    0x61, 0xc3, 0x07, 0xef, 0xff, 0x40, 0x5f, 0x86, 0x00, 0x20, 0xfe, 0x60, 0x54, 0x01, 0x03, 0xa7,
+    0x00, 0x21, 0xc0, 0x18, 0x14, 0x00, 0x11, 0x80, 0xf0, 0x00, 0x02, 0xa7, 0x00, 0x30, 0xfb, 0x30,
+    0x00, 0x15, 0x00, 0x14, 0xa1, 0x2c, 0x01, 0x40, 0x6e, 0xff, 0xff, 0xfb, 0x92, 0x00, 0x36, 0x1c,
+    0xff, 0xf4, 0x54, 0x01, 0x12, 0xcf, 0x7c, 0x01, 0x18, 0x0b, 0x7c, 0x01, 0x03, 0x68, 0x01, 0x0f,
+    0x90, 0x01, 0x01, 0x0f, 0xb8, 0x01, 0x01, 0x0f, 0xe0, 0x01, 0x01, 0x11, 0x0e, 0x08, 0x02, 0x30,
+    0x08, 0xff, 0xfd, 0xe6, 0x00, 0x03, 0x08, 0x02, 0x50, 0x00, 0x01, 0x10, 0x00, 0x00, 0xf2, 0x00,
+    0x00, 0xee, 0x00, 0x11, 0x01, 0x26, 0x01, 0x02, 0x05, 0x00, 0x10, 0x8f, 0xbb, 0x00, 0x12, 0xc2,
+    0x0c, 0x00, 0x03, 0x06, 0x00, 0x62, 0x0c, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x9c, 0x00, 0x03, 0x13,
+    0x00, 0x84, 0x00, 0x06, 0xff, 0xfe, 0x50, 0x1b, 0xff, 0xfc, 0x0f, 0x00, 0x02, 0x08, 0x00, 0x62,
+    0xbf, 0xa1, 0x00, 0x00, 0x6f, 0xf2, 0x0c, 0x00, 0x04, 0x06, 0x00, 0xd0, 0x15, 0x00, 0x00, 0x00,
+    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+E905 */
+    0x15, 0x00, 0x01, 0x00, 0x25, 0x11, 0x10, 0x0b, 0x00, 0x06, 0x09, 0x00, 0x36, 0x2f, 0xff, 0xa0,
+    0x0d, 0x00, 0x04, 0x0a, 0x00, 0x34, 0x02, 0xff, 0xfa, 0x0b, 0x00, 0x07, 0x08, 0x00, 0x0f, 0x2b,
+    0x00, 0x12, 0x11, 0x02, 0x31, 0x00, 0x03, 0x2b, 0x00, 0x11, 0x03, 0x0d, 0x00, 0x40, 0x00, 0x00,
+    0x0a, 0xf3, 0x09, 0x00, 0x30, 0x01, 0x88, 0x85, 0x07, 0x00, 0x20, 0x04, 0xfb, 0x06, 0x00, 0x52,
+    0x00, 0x00, 0x0a, 0xff, 0xf4, 0x09, 0x00, 0x00, 0x06, 0x00, 0x22, 0x04, 0xff, 0x16, 0x00, 0x40,
+    0x01, 0xef, 0xff, 0xf5, 0x10, 0x00, 0x01, 0x04, 0x00, 0x41, 0x04, 0xff, 0xff, 0xe1, 0x09, 0x00,
+    0x23, 0x02, 0xef, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x30, 0xef, 0xff, 0xe2, 0x07, 0x00, 0xf3, 0x01,
+    0x00, 0x00, 0x02, 0xdf, 0xf3, 0x00, 0x00, 0x02, 0x7b, 0xde, 0xdb, 0x73, 0x00, 0x00, 0x02, 0xef,
+    0x15, 0x00, 0xf2, 0x00, 0x00, 0x01, 0xc3, 0x00, 0x00, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30,
+    0x00, 0x02, 0xc2, 0x2a, 0x00, 0x01, 0x06, 0x00, 0x10, 0x6f, 0x15, 0x00, 0x31, 0xff, 0xff, 0x70,
+    0x0d, 0x00, 0x04, 0x05, 0x00, 0x94, 0x8f, 0xff, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xff, 0x90, 0x11,
+    0x00, 0x00, 0x08, 0x00, 0xa0, 0x5f, 0xff, 0xfe, 0x71, 0x00, 0x01, 0x6e, 0xff, 0xff, 0x60, 0x0e,
+    0x00, 0x03, 0x04, 0x00, 0x30, 0x1f, 0xff, 0xfb, 0x40, 0x01, 0x43, 0x0b, 0xff, 0xff, 0x20, 0x12,
+    0x00, 0x61, 0x00, 0x00, 0x00, 0x09, 0xff, 0xfc, 0x0d, 0x00, 0x19, 0x0b, 0x31, 0x01, 0x20, 0xff,
+    0xff, 0x2a, 0x00, 0x51, 0x00, 0x00, 0x1f, 0xff, 0xf1, 0x1e, 0x00, 0x01, 0x05, 0x00, 0x14, 0x5f,
+    0x64, 0x00, 0x13, 0x8f, 0x57, 0x00, 0x54, 0xbb, 0xbb, 0xb6, 0x00, 0x08, 0x04, 0x01, 0xe3, 0x03,
+    0xff, 0xf9, 0x00, 0x06, 0xbb, 0xbb, 0xb0, 0x1f, 0xff, 0xff, 0x80, 0x00, 0xaf, 0x40, 0x00, 0xf1,
+    0x01, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x8f, 0xff, 0xff, 0x11, 0xff, 0xff, 0xf8, 0x00, 0x0b, 0xff,
+    0xf0, 0x48, 0x00, 0x91, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x08, 0xff, 0xff, 0xf1, 0x2b, 0x00, 0x14,
+    0x9f, 0x2b, 0x00, 0x30, 0x1f, 0xff, 0xa0, 0x2b, 0x00, 0x01, 0x79, 0x00, 0x14, 0x07, 0x44, 0x01,
+    0x33, 0x04, 0xff, 0xf8, 0x34, 0x00, 0x62, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xb0, 0x0d, 0x00, 0x32,
+    0xaf, 0xff, 0x40, 0x09, 0x00, 0x00, 0x06, 0x00, 0x13, 0xef, 0x0d, 0x00, 0x15, 0x3f, 0x5f, 0x00,
+    0x61, 0x00, 0x00, 0x00, 0x06, 0xff, 0xfe, 0xe5, 0x00, 0x30, 0x2e, 0xff, 0xf7, 0x24, 0x00, 0x03,
+    0x04, 0x00, 0xa3, 0x0d, 0xff, 0xfe, 0x50, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xfe, 0x11, 0x00, 0x01,
+    0x07, 0x00, 0xa1, 0x2e, 0xff, 0xff, 0xc6, 0x32, 0x36, 0xcf, 0xff, 0xff, 0x30, 0x0f, 0x00, 0x03,
+    0x05, 0x00, 0x12, 0x3e, 0x6d, 0x01, 0x03, 0x5d, 0x00, 0x01, 0x15, 0x00, 0x41, 0x02, 0x00, 0x00,
+    0x2c, 0x16, 0x00, 0x32, 0xfd, 0x20, 0x00, 0x26, 0x02, 0xf4, 0x01, 0x00, 0x00, 0x00, 0x05, 0xf7,
+    0x00, 0x00, 0x05, 0xdf, 0xff, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x06, 0xfa, 0x01, 0x11, 0x04, 0x77,
+    0x00, 0x40, 0x26, 0x79, 0x86, 0x20, 0x8b, 0x00, 0x03, 0x16, 0x00, 0x05, 0x0d, 0x02, 0x00, 0x4d,
+    0x00, 0x13, 0xef, 0x38, 0x01, 0x24, 0x02, 0xff, 0x0d, 0x02, 0x10, 0x00, 0x04, 0x02, 0x20, 0xff,
+    0xf2, 0x1d, 0x00, 0x27, 0x00, 0x07, 0x15, 0x00, 0x33, 0x00, 0x02, 0xdf, 0xc4, 0x00, 0x11, 0x07,
+    0x22, 0x02, 0x30, 0x01, 0xaa, 0xa6, 0x24, 0x00, 0x20, 0x01, 0xd8, 0x06, 0x00, 0x41, 0x00, 0x00,
+    0x00, 0x01, 0x08, 0x00, 0x03, 0xb0, 0x02, 0x02, 0x0d, 0x00, 0x01, 0x12, 0x00, 0x00, 0x50, 0x00,
+    0x09, 0xd5, 0x01, 0x04, 0x16, 0x00, 0x03, 0x2b, 0x00, 0x04, 0x0f, 0x00, 0x02, 0x08, 0x00, 0x0f,
+    0x31, 0x03, 0x05, 0xa0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
 
@@ -590,6 +204,23 @@ static const lv_font_fmt_txt_cmap_t cmaps[] =
 
 
 
+/*Compressed glyphs, sorted by unicode (see App_Asset_Cache.h)*/
+static const asset_glyph_t glyph_pack[] = {
+    {.unicode = 0x0020, .offset = 0, .packed_len = 0, .raw_len = 0},
+    {.unicode = 0xE900, .offset = 0, .packed_len = 168, .raw_len = 488},
+    {.unicode = 0xE901, .offset = 168, .packed_len = 314, .raw_len = 722},
+    {.unicode = 0xE902, .offset = 482, .packed_len = 157, .raw_len = 488},
+    {.unicode = 0xE903, .offset = 639, .packed_len = 481, .raw_len = 761},
+    {.unicode = 0xE904, .offset = 1120, .packed_len = 505, .raw_len = 800},
+    {.unicode = 0xE905, .offset = 1625, .packed_len = 558, .raw_len = 903},
+};
+
+static const asset_font_pack_t font_pack = {
+    .glyphs = glyph_pack,
+    .glyph_cnt = 7,
+    .data = glyph_bitmap,
+};
+
 /*--------------------
  *  ALL CUSTOM DATA
  *--------------------*/
@@ -631,7 +262,7 @@ const lv_font_t ui_font_IconFont3 = {
 lv_font_t ui_font_IconFont3 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = asset_font_get_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 42,          /*The maximum line height required by the font*/
     .base_line = 1,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -645,7 +276,7 @@ lv_font_t ui_font_IconFont3 = {
 #if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
     .fallback = NULL,
 #endif
-    .user_data = NULL,
+    .user_data = (void *)&font_pack,
 };
 
 